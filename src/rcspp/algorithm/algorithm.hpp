@@ -5,34 +5,36 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>  // NOLINT(build/c++11)
 #include <cmath>
 #include <concepts>  // NOLINT(build/include_order)
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <list>
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "rcspp/algorithm/cancellation_token.hpp"
+#include "rcspp/algorithm/shared_search_state.hpp"
 #include "rcspp/algorithm/solution.hpp"
+#include "rcspp/graph/arc_mask.hpp"
 #include "rcspp/graph/graph.hpp"
 #include "rcspp/label/label_pool.hpp"
 #include "rcspp/utils/timer.hpp"
 
 namespace rcspp {
 
-template <typename ResourceType>
-using LabelIterator = std::list<Label<ResourceType>*>::iterator;
-
-template <typename ResourceType>
-using LabelIteratorPair =
-    std::pair<Label<ResourceType>*, typename std::list<Label<ResourceType>*>::iterator>;
-
 constexpr int MAX_INT = std::numeric_limits<int>::max() / 2;  // to avoid overflow
 
+// Called with each new solution as soon as it is found. Return false to stop the search.
+using SolutionCallback = std::function<bool(const Solution&)>;
+
 struct AlgorithmParams {
         AlgorithmParams& check() {
             if (num_max_phases > 1 && num_labels_to_extend_by_node >= MAX_INT) {
@@ -57,7 +59,9 @@ struct AlgorithmParams {
         }
 
         [[nodiscard]] bool could_be_non_optimal() const {
-            return ((stop_after_X_solutions < MAX_INT) || (num_labels_to_extend_by_node < MAX_INT));
+            return ((stop_after_X_solutions < MAX_INT) ||
+                    (num_labels_to_extend_by_node < MAX_INT) || warm_start ||
+                    std::isfinite(time_limit) || (max_num_labels < MAX_INT));
         }
 
         // stop after finding X solutions (not going to optimality)
@@ -85,6 +89,23 @@ struct AlgorithmParams {
         bool tabu_random_noise = true;
 
         int seed = 0;
+
+        // number of threads for parallel algorithms (0 = number of hardware threads)
+        size_t num_threads = 0;
+
+        // re-solve from the labels of the previous solve when only the costs of the arcs changed
+        // (see Algorithm::solve)
+        bool warm_start = false;
+
+        // maximum time of a solve in seconds: the solve then returns the solutions found so far
+        double time_limit = std::numeric_limits<double>::infinity();
+
+        // cancel running solves from another thread (see CancellationToken)
+        CancellationToken cancellation_token;
+
+        // maximum number of labels in use by a solve: once reached, a new label is only kept if
+        // it is the cheapest at its node (heuristic dominance on the cost), to bound the memory
+        size_t max_num_labels = MAX_INT;
 };
 
 template <typename ResourceType>
@@ -105,12 +126,17 @@ class Algorithm {
          * i.e., when @ref number_of_labels returns zero. This typically means that all possible
          * extensions have been explored and no further improvements or solutions can be found.
          *
-         * The default implementation returns true if @ref number_of_labels() == 0.
-         * Derived classes may override this method to provide a more specific notion of optimality.
+         * The default implementation returns true if @ref number_of_labels() == 0 and the last
+         * solve was neither warm-started, nor stopped early (time limit, cancellation or request
+         * of another algorithm), nor degraded by the label budget (see
+         * AlgorithmParams::max_num_labels). Derived classes may override this method to provide a
+         * more specific notion of optimality.
          *
          * @return true if the algorithm is optimal (no labels left to process), false otherwise.
          */
-        [[nodiscard]] virtual bool is_optimal() const { return number_of_labels() == 0; }
+        [[nodiscard]] virtual bool is_optimal() const {
+            return !warm_started_ && !stopped_ && !over_label_budget_ && number_of_labels() == 0;
+        }
 
         virtual void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) {
             if (!graph->get_sorted_nodes().empty() && !graph->are_nodes_sorted()) {
@@ -124,32 +150,74 @@ class Algorithm {
 
             graph_ = graph;
             cost_upper_bound_ = cost_upper_bound;
-            label_pool_.clear();
+            stopped_ = false;
+            over_label_budget_ = false;
+            label_pool_.reset();
             solutions_.clear();
+
+            completion_bound_by_node_pos_.clear();
+            if (!completion_bound_by_node_id_.empty()) {
+                completion_bound_by_node_pos_.resize(graph->get_number_of_nodes(), 0.0);
+                for (const auto* node : graph->get_sorted_nodes()) {
+                    auto it = completion_bound_by_node_id_.find(node->id);
+                    if (it != completion_bound_by_node_id_.end()) {
+                        completion_bound_by_node_pos_[node->pos()] = it->second;
+                    }
+                }
+            }
         }
 
+        /**
+         * @brief Solves the RCSPP on the graph.
+         *
+         * With AlgorithmParams::warm_start, if the previous solve was on the same graph and
+         * processed all its labels, the labels kept at the sinks by the last solve from scratch
+         * are first re-extended along their paths with the current resources of the arcs (e.g.,
+         * after update_reduced_costs), without extending any new label. Each warm solve
+         * re-evaluates all of these labels. Their non-dominated solutions cheaper than the upper
+         * bound are returned and the algorithm is not optimal (see @ref is_optimal). If there are
+         * none, the graph is solved from scratch. The nodes and arcs of the graph must not change
+         * between the solves, only the resources of the arcs.
+         *
+         * The solve stops early, with the solutions found so far, once AlgorithmParams::time_limit
+         * or the deadline (see @ref set_deadline) is reached, or once the cancellation token of
+         * the parameters is cancelled. The algorithm is then not optimal.
+         *
+         * With a solution callback (see @ref set_solution_callback), the solutions are also given
+         * to the callback as soon as they are found.
+         */
         virtual std::vector<Solution> solve(const Graph<ResourceType>* graph,
                                             double cost_upper_bound) {
-            // initialization
             Timer timer;
-            initialize(graph, cost_upper_bound);
-
-            // initialize labels
-            this->initialize_labels();
-
-            size_t num_phases = 0;
-            while (solutions_.size() < params_.stop_after_X_solutions && number_of_labels() > 0) {
-                // main labeling loop
-                main_loop();
-
-                // extract solutions any remaining solutions
-                extract_remaining_solutions();
-
-                // prepare next phase (if any)
-                if (++num_phases < params_.num_max_phases) {
-                    prepareNextPhase();
-                } else {
-                    break;
+            start_deadline();
+            best_solution_cost_ = std::numeric_limits<double>::infinity();
+            callback_stopped_ = false;
+
+            warm_started_ = params_.warm_start && graph == graph_ && all_labels_processed() &&
+                            warm_start(cost_upper_bound);
+
+            if (!warm_started_) {
+                // initialization
+                initialize(graph, cost_upper_bound);
+
+                // initialize labels
+                this->initialize_labels();
+
+                size_t num_phases = 0;
+                while (solutions_.size() < params_.stop_after_X_solutions &&
+                       number_of_labels() > 0 && !stopped_) {
+                    // main labeling loop
+                    main_loop();
+
+                    // extract solutions any remaining solutions
+                    extract_remaining_solutions();
+
+                    // prepare next phase (if any)
+                    if (++num_phases < params_.num_max_phases) {
+                        prepareNextPhase();
+                    } else {
+                        break;
+                    }
                 }
             }
 
@@ -184,6 +252,75 @@ class Algorithm {
 
         [[nodiscard]] bool all_labels_processed() const { return number_of_labels() == 0; }
 
+        // Memory used by the labels of the algorithm in bytes, excluding the memory owned by their
+        // resources.
+        [[nodiscard]] virtual size_t get_memory_usage() const {
+            return label_pool_.get_memory_usage();
+        }
+
+        /**
+         * @brief Sets lower bounds on the cost from each node to a sink (e.g., shortest paths
+         * without resource constraints).
+         *
+         * During the next solves, a label whose cost plus the bound of its node exceeds the cost
+         * upper bound cannot lead to a solution and is discarded as soon as it is created. The
+         * bounds must remain valid for the graph and costs of these solves. An empty map disables
+         * the pruning.
+         *
+         * @param completion_bound_by_node_id Lower bound on the cost to reach a sink, by node id
+         * (0 for the missing nodes).
+         */
+        void set_completion_bounds(std::unordered_map<size_t, double> completion_bound_by_node_id) {
+            completion_bound_by_node_id_ = std::move(completion_bound_by_node_id);
+        }
+
+        /**
+         * @brief Sets the arcs to skip during the next solves (e.g., the arcs that cannot be part
+         * of a path cheaper than the upper bound), without removing them from the graph.
+         *
+         * @param arc_mask Removed arcs (none if empty).
+         */
+        void set_arc_mask(ArcMask arc_mask) { arc_mask_ = std::move(arc_mask); }
+
+        /**
+         * @brief Shares the solutions found during the next solves with other algorithms running
+         * concurrently (see PortfolioAlgorithm).
+         *
+         * The algorithm reports its solutions to the shared state, stops as soon as the state
+         * requests it (returning the solutions found so far) and uses the upper bound of the
+         * state when it is lower than its own.
+         *
+         * @param shared_state Shared state (nullptr to solve alone), must outlive the solves.
+         */
+        virtual void set_shared_state(SharedSearchState* shared_state) {
+            shared_state_ = shared_state;
+        }
+
+        /**
+         * @brief Sets a time at which the next solves stop, with the solutions found so far, in
+         * addition to AlgorithmParams::time_limit (e.g., the deadline of an enclosing search).
+         *
+         * @param deadline Time to stop at (Timer::time_point::max() for none).
+         */
+        virtual void set_deadline(Timer::time_point deadline) { external_deadline_ = deadline; }
+
+        /**
+         * @brief Gives each new solution of the next solves to the callback as soon as it is
+         * found, e.g., to add the columns to the master problem while the search goes on.
+         *
+         * The solutions are streamed in the order they are found, not sorted by cost. The labels
+         * reaching a sink with a cost lower than all the solutions found so far are extracted
+         * immediately (even if they are dominated later), the others at the end of the solve. The
+         * search stops, with the solutions found so far, once the callback returns false. The
+         * solve still returns all its solutions.
+         *
+         * @param callback Solution callback (empty for none), called by the solving thread (one
+         * worker thread at a time for ParallelDominanceAlgorithm).
+         */
+        virtual void set_solution_callback(SolutionCallback callback) {
+            solution_callback_ = std::move(callback);
+        }
+
     protected:
         bool print_{false};
 
@@ -195,6 +332,11 @@ class Algorithm {
 
         virtual void main_loop() = 0;
 
+        // Re-extend the labels kept at the sinks by the last cold solve (and their ancestors) with
+        // the current resources of the arcs, and update their dominance (see solve). Return false
+        // if the algorithm does not support warm starts.
+        virtual bool update_labels_at_sinks() { return false; }
+
         void extract_remaining_solutions() {
             auto labels_at_sinks = this->get_labels_at_sinks();
             for (const auto* sink_label : labels_at_sinks) {
@@ -216,20 +358,127 @@ class Algorithm {
                 return;
             }
 
+            add_solution(end_label.get_cost(), std::move(path_arc_ids));
+        }
+
+        // Store the solution following the given (non-empty) arc path, unless already extracted.
+        void add_solution(double cost, std::list<size_t> path_arc_ids) {
             std::list<size_t> path_node_ids;
             for (size_t arc_id : path_arc_ids) {
                 path_node_ids.push_back(this->graph_->get_arc(arc_id)->origin->id);
             }
-            path_node_ids.push_back(end_label.get_end_node()->id);
-            auto sol =
-                Solution(end_label.get_cost(), std::move(path_node_ids), std::move(path_arc_ids));
+            path_node_ids.push_back(this->graph_->get_arc(path_arc_ids.back())->destination->id);
+            add_solution(Solution(cost, std::move(path_node_ids), std::move(path_arc_ids)));
+        }
 
+        // Store the solution and stream it (see set_solution_callback). Return false if it was
+        // already extracted.
+        bool add_solution(Solution sol) {
             // solution already extracted
             if (solutions_.contains(sol)) {
-                return;
+                return false;
             }
 
+            if (shared_state_ != nullptr) {
+                shared_state_->add_solution(sol);
+            }
+            best_solution_cost_ = std::min(best_solution_cost_, sol.cost);
+            if (solution_callback_ && !callback_stopped_ && !solution_callback_(sol)) {
+                LOG_DEBUG("Stopping on solution callback.\n");
+                callback_stopped_ = true;
+                stopped_ = true;
+            }
             solutions_.insert(std::move(sol));
+            return true;
+        }
+
+        // Whether a sink label must be extracted as soon as it is processed: it improves on all
+        // the solutions found so far and the solutions are streamed (see set_solution_callback).
+        [[nodiscard]] bool is_streamed(const Label<ResourceType>& sink_label) const {
+            return solution_callback_ && !callback_stopped_ &&
+                   sink_label.get_cost() < best_solution_cost_;
+        }
+
+        // Whether the labels in use exceed the budget of the solve (see
+        // AlgorithmParams::max_num_labels). Once exceeded, the solve is degraded until its end.
+        [[nodiscard]] bool is_over_label_budget() {
+            if (!over_label_budget_ &&
+                label_pool_.get_number_of_labels_in_use() >= params_.max_num_labels) {
+                LOG_WARN("Label budget of ",
+                         params_.max_num_labels,
+                         " labels exceeded: heuristic dominance until the end of the solve.\n");
+                over_label_budget_ = true;
+            }
+            return over_label_budget_;
+        }
+
+        // Compute the deadline of the solve that starts (see set_deadline).
+        void start_deadline() {
+            deadline_ = external_deadline_;
+            if (std::isfinite(params_.time_limit)) {
+                deadline_ = std::min(
+                    deadline_,
+                    Timer::clock::now() + std::chrono::duration_cast<Timer::duration>(
+                                              std::chrono::duration<double>(params_.time_limit)));
+            }
+        }
+
+        // Whether the solve must stop: time limit reached, cancelled, or requested by another
+        // algorithm (see set_shared_state). Only reads: can be called by several threads.
+        [[nodiscard]] bool stop_requested() const {
+            return params_.cancellation_token.is_cancelled() ||
+                   (shared_state_ != nullptr && shared_state_->stop_requested()) ||
+                   (deadline_ != Timer::time_point::max() && Timer::clock::now() >= deadline_);
+        }
+
+        // Same as stop_requested, records that the solve stopped early and tighten the upper bound
+        // with the shared one. Called once per iteration of the main loops.
+        [[nodiscard]] bool must_stop() {
+            if (shared_state_ != nullptr) {
+                cost_upper_bound_ = std::min(cost_upper_bound_, shared_state_->get_upper_bound());
+            }
+            if (stop_requested()) {
+                stopped_ = true;
+            }
+            return stopped_;
+        }
+
+        // Extract the solutions of the labels of the previous solve (see solve). Return false if
+        // there are none.
+        bool warm_start(double cost_upper_bound) {
+            cost_upper_bound_ = cost_upper_bound;
+            solutions_.clear();
+            if (!update_labels_at_sinks()) {
+                return false;
+            }
+            extract_remaining_solutions();
+            LOG_DEBUG("Warm start: ", solutions_.size(), " solutions\n");
+
+            return !solutions_.empty();
+        }
+
+        [[nodiscard]] double get_completion_bound(const Node<ResourceType>* node) const {
+            return completion_bound_by_node_pos_.empty()
+                       ? 0.0
+                       : completion_bound_by_node_pos_[node->pos()];
+        }
+
+        [[nodiscard]] const std::unordered_map<size_t, double>& get_completion_bounds() const {
+            return completion_bound_by_node_id_;
+        }
+
+        [[nodiscard]] const ArcMask& get_arc_mask() const { return arc_mask_; }
+
+        // Whether the arc is skipped by the current solve (see set_arc_mask).
+        [[nodiscard]] bool is_arc_removed(const Arc<ResourceType>& arc) const {
+            return arc_mask_.is_removed(arc.id);
+        }
+
+        // Whether the label cannot be completed into a solution cheaper than the upper bound.
+        [[nodiscard]] bool exceeds_upper_bound(const Label<ResourceType>& label) const {
+            return !completion_bound_by_node_pos_.empty() &&
+                   label.get_cost() + completion_bound_by_node_pos_[label.get_end_node()->pos()] >
+                       cost_upper_bound_;
         }
 
         LabelPool<ResourceType> label_pool_;
@@ -239,7 +488,31 @@ class Algorithm {
         double cost_upper_bound_ = std::numeric_limits<double>::infinity();
         std::unordered_set<Solution> solutions_;
 
+        // whether the last solve returned the solutions of the labels of the previous solve
+        bool warm_started_{false};
+
+        // whether the last solve stopped early (see must_stop)
+        bool stopped_{false};
+
+        // whether the last solve exceeded its label budget (see is_over_label_budget)
+        bool over_label_budget_{false};
+
+        // time at which the current solve stops (see set_deadline)
+        Timer::time_point deadline_{Timer::time_point::max()};
+
         size_t nb_dominated_labels_{0};
         Timer total_full_extend_time_;
+
+    private:
+        std::unordered_map<size_t, double> completion_bound_by_node_id_;
+        std::vector<double> completion_bound_by_node_pos_;
+        ArcMask arc_mask_;
+        SharedSearchState* shared_state_ = nullptr;
+        Timer::time_point external_deadline_{Timer::time_point::max()};
+        SolutionCallback solution_callback_;
+        // cost of the best solution of the current solve
+        double best_solution_cost_ = std::numeric_limits<double>::infinity();
+        // whether the callback requested to stop the current solve
+        bool callback_stopped_{false};
 };
 }  // namespace rcspp
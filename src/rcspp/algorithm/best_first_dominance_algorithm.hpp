@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "rcspp/algorithm/dominance_algorithm.hpp"
+
+namespace rcspp {
+
+/**
+ * @brief BestFirstDominanceAlgorithm: label-setting algorithm processing the cheapest label first.
+ *
+ * The unprocessed labels are kept in a binary heap ordered by their cost plus the completion bound
+ * of their node (see Algorithm::set_completion_bounds), i.e., by their cost if no bounds are given.
+ * Ties are broken in creation order. Combined with return_dominated_solutions and
+ * stop_after_X_solutions, the cheapest solutions are found after extending a fraction of the
+ * labels, without truncating the labels blindly. With negative costs and without completion
+ * bounds, the order is close to a depth-first search and more labels may be dominated afterwards
+ * than with the FIFO order when solving to optimality.
+ *
+ * Truncation (num_labels_to_extend_by_node) is not supported.
+ */
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class BestFirstDominanceAlgorithm : public DominanceAlgorithm<ResourceType> {
+    public:
+        BestFirstDominanceAlgorithm(ResourceFactory<ResourceType>* resource_factory,
+                                    AlgorithmParams params)
+            : DominanceAlgorithm<ResourceType>(resource_factory, std::move(params)) {
+            if (this->params_.num_labels_to_extend_by_node < MAX_INT) {
+                LOG_WARN(
+                    "BestFirstDominanceAlgorithm: num_labels_to_extend_by_node is not supported "
+                    "and will be ignored.\n");
+            }
+        }
+
+        ~BestFirstDominanceAlgorithm() override = default;
+
+    private:
+        struct HeapEntry {
+                double key;
+                size_t order;
+                Label<ResourceType>* label;
+
+                // std::priority_queue is a max-heap: the greatest entry is the lowest key
+                bool operator<(const HeapEntry& other) const {
+                    return key > other.key || (key == other.key && order > other.order);
+                }
+        };
+
+        void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
+            DominanceAlgorithm<ResourceType>::initialize(graph, cost_upper_bound);
+            unprocessed_labels_ = {};
+            num_created_labels_ = 0;
+        }
+
+        Label<ResourceType>* next_label() override {
+            while (!unprocessed_labels_.empty()) {
+                auto* label_ptr = unprocessed_labels_.top().label;
+                unprocessed_labels_.pop();
+
+                if (!label_ptr->dominated) {
+                    return label_ptr;
+                }
+                this->label_pool_.release_label(label_ptr);
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] size_t number_of_labels() const override {
+            return unprocessed_labels_.size();
+        }
+
+        void add_new_unprocessed_label(Label<ResourceType>* label_ptr) override {
+            const double key =
+                label_ptr->get_cost() + this->get_completion_bound(label_ptr->get_end_node());
+            unprocessed_labels_.push({key, num_created_labels_++, label_ptr});
+        }
+
+        std::priority_queue<HeapEntry> unprocessed_labels_;
+        size_t num_created_labels_ = 0;
+};
+}  // namespace rcspp
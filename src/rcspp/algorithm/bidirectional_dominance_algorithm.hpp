@@ -0,0 +1,380 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rcspp/algorithm/algorithm.hpp"
+#include "rcspp/algorithm/dominance_algorithm.hpp"
+#include "rcspp/graph/graph.hpp"
+
+namespace rcspp {
+
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class BidirectionalDominanceAlgorithm;
+
+// Function returning the value of the (monotone) resource used to split the search in two halves.
+template <typename ResourceType>
+using MidpointResourceFunction = std::function<double(const Resource<ResourceType>&)>;
+
+// Function returning whether a forward label and a backward label at the same node can be joined
+// (e.g., their times add up to at most the horizon), given their resources. It must only reject
+// joins that are infeasible: it is a cheap test done before re-evaluating the joined path.
+template <typename ResourceType>
+using JoinCompatibilityFunction =
+    std::function<bool(const Resource<ResourceType>&, const Resource<ResourceType>&)>;
+
+// One direction of the bidirectional search: a FIFO labeling that stops extending the labels whose
+// midpoint resource exceeds the midpoint. These labels are kept at their node to be joined.
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class HalfwayDominanceAlgorithm : public DominanceAlgorithm<ResourceType> {
+        friend class BidirectionalDominanceAlgorithm<ResourceType>;
+
+    public:
+        HalfwayDominanceAlgorithm(ResourceFactory<ResourceType>* resource_factory,
+                                  AlgorithmParams params,
+                                  MidpointResourceFunction<ResourceType> midpoint_resource,
+                                  double midpoint)
+            : DominanceAlgorithm<ResourceType>(resource_factory, std::move(params)),
+              midpoint_resource_(std::move(midpoint_resource)),
+              midpoint_(midpoint) {}
+
+        [[nodiscard]] bool is_past_midpoint(const Label<ResourceType>& label) const {
+            return midpoint_resource_(label.get_resource()) > midpoint_;
+        }
+
+    private:
+        void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
+            DominanceAlgorithm<ResourceType>::initialize(graph, cost_upper_bound);
+            unprocessed_labels_.clear();
+        }
+
+        Label<ResourceType>* next_label() override {
+            while (!unprocessed_labels_.empty()) {
+                auto* label_ptr = unprocessed_labels_.front();
+                unprocessed_labels_.pop_front();
+                if (!label_ptr->dominated) {
+                    return label_ptr;
+                }
+                this->label_pool_.release_label(label_ptr);
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] size_t number_of_labels() const override {
+            return unprocessed_labels_.size();
+        }
+
+        void add_new_unprocessed_label(Label<ResourceType>* label_ptr) override {
+            unprocessed_labels_.push_back(label_ptr);
+        }
+
+        void extend(Label<ResourceType>* label_ptr) override {
+            if (!is_past_midpoint(*label_ptr)) {
+                DominanceAlgorithm<ResourceType>::extend(label_ptr);
+            }
+        }
+
+        MidpointResourceFunction<ResourceType> midpoint_resource_;
+        double midpoint_;
+
+        std::list<Label<ResourceType>*> unprocessed_labels_;
+};
+
+/**
+ * @brief BidirectionalDominanceAlgorithm for Resource Constrained Shortest Path Problems (RCSPP).
+ *
+ * Forward labels are extended from the sources of the graph and backward labels from the sources
+ * of a backward graph, i.e., the reversed problem whose arcs go from the original sinks to the
+ * original sources and keep the ids of the original arcs. Each search stops extending a label once
+ * its midpoint resource (e.g., the time) exceeds its midpoint. A forward label that went past the
+ * midpoint is then joined with the backward labels of its node: the concatenated path is
+ * re-evaluated with the forward extension functions, so any feasible join is a feasible path.
+ *
+ * The backward graph must model the reversed resource consumption, e.g., for a time resource with
+ * a horizon H, a time window [a, b] becomes [H - b, H - a] and the forward and backward midpoints
+ * must add up to H. The cost must be additive along the path, so that the cost of a join is the
+ * sum of the forward and backward costs. The reduced costs of both graphs must be kept in sync.
+ *
+ * Each pair of a forward and a backward label is re-evaluated along the whole path of the backward
+ * label. Give a compatibility function (see JoinCompatibilityFunction) to reject the incompatible
+ * pairs beforehand, e.g., forward time + backward time > H or forward load + backward load >
+ * capacity.
+ *
+ * Use this algorithm when the labels are long and the number of labels grows quickly with the
+ * length of the paths, as each direction only enumerates half-length partial paths.
+ */
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class BidirectionalDominanceAlgorithm : public Algorithm<ResourceType> {
+    public:
+        BidirectionalDominanceAlgorithm(ResourceFactory<ResourceType>* resource_factory,
+                                        AlgorithmParams params, Graph<ResourceType>* backward_graph,
+                                        MidpointResourceFunction<ResourceType> midpoint_resource,
+                                        double forward_midpoint, double backward_midpoint,
+                                        JoinCompatibilityFunction<ResourceType> are_compatible = {})
+            : Algorithm<ResourceType>(resource_factory, std::move(params)),
+              backward_graph_(backward_graph),
+              forward_(std::make_unique<HalfwayDominanceAlgorithm<ResourceType>>(
+                  resource_factory, half_params(this->params_), midpoint_resource,
+                  forward_midpoint)),
+              backward_(std::make_unique<HalfwayDominanceAlgorithm<ResourceType>>(
+                  resource_factory, half_params(this->params_), std::move(midpoint_resource),
+                  backward_midpoint)),
+              are_compatible_(std::move(are_compatible)) {}
+
+        ~BidirectionalDominanceAlgorithm() override = default;
+
+        [[nodiscard]] size_t get_memory_usage() const override {
+            return Algorithm<ResourceType>::get_memory_usage() + forward_->get_memory_usage() +
+                   backward_->get_memory_usage();
+        }
+
+        // Both halves stop with the search (their labels are not solutions: nothing to share).
+        void set_shared_state(SharedSearchState* shared_state) override {
+            Algorithm<ResourceType>::set_shared_state(shared_state);
+            forward_->set_shared_state(shared_state);
+            backward_->set_shared_state(shared_state);
+        }
+
+    protected:
+        void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
+            Algorithm<ResourceType>::initialize(graph, cost_upper_bound);
+
+            if (backward_graph_ == nullptr ||
+                backward_graph_->get_number_of_nodes() != graph->get_number_of_nodes()) {
+                LOG_FATAL(
+                    "BidirectionalDominanceAlgorithm: the backward graph must have the same nodes "
+                    "as the forward graph.\n");
+                throw std::runtime_error(
+                    "BidirectionalDominanceAlgorithm: the backward graph must have the same nodes "
+                    "as the forward graph.");
+            }
+
+            // if not sorted, use default sort (by id)
+            if (backward_graph_->get_sorted_nodes().size() !=
+                    backward_graph_->get_number_of_nodes() ||
+                !backward_graph_->are_nodes_sorted()) {
+                backward_graph_->sort_nodes();
+            }
+
+            prefix_arc_ids_by_label_.clear();
+            suffix_arcs_by_label_.clear();
+        }
+
+        void initialize_labels() override {
+            // the arc mask is given for the forward graph only
+            forward_->set_arc_mask(this->get_arc_mask());
+            // both halves stop at the deadline of the search
+            forward_->deadline_ = this->deadline_;
+            backward_->deadline_ = this->deadline_;
+            forward_->initialize(this->graph_, this->cost_upper_bound_);
+            forward_->initialize_labels();
+            backward_->initialize(backward_graph_, this->cost_upper_bound_);
+            backward_->initialize_labels();
+        }
+
+        [[nodiscard]] size_t number_of_labels() const override {
+            return forward_->number_of_labels() + backward_->number_of_labels();
+        }
+
+        void main_loop() override {
+            forward_->main_loop();
+            backward_->main_loop();
+            // each half has its own label budget
+            this->over_label_budget_ =
+                forward_->over_label_budget_ || backward_->over_label_budget_;
+
+            // paths that never went past the midpoint are found by the forward search alone
+            for (const auto* sink_label : forward_->get_labels_at_sinks()) {
+                if (sink_label->get_cost() < this->cost_upper_bound_) {
+                    auto path_arc_ids = forward_->get_path_arc_ids(*sink_label);
+                    if (!path_arc_ids.empty()) {
+                        this->add_solution(sink_label->get_cost(), std::move(path_arc_ids));
+                    }
+                }
+            }
+
+            join();
+
+            LOG_DEBUG("BidirectionalDominanceAlgorithm: nb joins: ",
+                      nb_joins_,
+                      ", nb incompatible joins: ",
+                      nb_incompatible_joins_,
+                      "\n");
+        }
+
+        // Solutions are added directly when joining the labels of both directions.
+        [[nodiscard]] std::list<Label<ResourceType>*> get_labels_at_sinks() const override {
+            return {};
+        }
+
+        std::list<size_t> get_path_arc_ids(const Label<ResourceType>& label) override {
+            return forward_->get_path_arc_ids(label);
+        }
+
+    private:
+        static AlgorithmParams half_params(AlgorithmParams params) {
+            // each half must be complete for the joins to be exact
+            params.stop_after_X_solutions = MAX_INT;
+            params.return_dominated_solutions = false;
+            params.num_labels_to_extend_by_node = MAX_INT;
+            params.num_max_phases = 1;
+            return params;
+        }
+
+        void join() {
+            for (const auto* node : this->graph_->get_sorted_nodes()) {
+                if (node->sink) {
+                    continue;
+                }
+
+                const auto& labels = backward_->non_dominated_labels_by_node_pos_.at(
+                    backward_graph_->get_node(node->id)->pos());
+                if (labels.empty()) {
+                    continue;
+                }
+
+                // sort by cost to stop as soon as the joins exceed the upper bound
+                std::vector<const Label<ResourceType>*> backward_labels(labels.begin(),
+                                                                        labels.end());
+                std::ranges::sort(backward_labels,
+                                  [](const Label<ResourceType>* l1, const Label<ResourceType>* l2) {
+                                      return l1->get_cost() < l2->get_cost();
+                                  });
+
+                for (const auto* forward_label :
+                     forward_->non_dominated_labels_by_node_pos_.at(node->pos())) {
+                    // labels before the midpoint have been extended and are joined further
+                    if (!forward_->is_past_midpoint(*forward_label)) {
+                        continue;
+                    }
+                    if (this->must_stop()) {
+                        LOG_DEBUG("Stopping on request.\n");
+                        return;
+                    }
+
+                    for (const auto* backward_label : backward_labels) {
+                        if (forward_label->get_cost() + backward_label->get_cost() >=
+                            this->cost_upper_bound_) {
+                            break;
+                        }
+
+                        if (are_compatible_ && !are_compatible_(forward_label->get_resource(),
+                                                                backward_label->get_resource())) {
+                            ++nb_incompatible_joins_;
+                            continue;
+                        }
+
+                        join(*forward_label, *backward_label);
+                        if (this->solutions_.size() >= this->params_.stop_after_X_solutions) {
+                            LOG_DEBUG("Stopping after ", this->solutions_.size(), " solutions.\n");
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Extend the forward label along the path of the backward label.
+        void join(const Label<ResourceType>& forward_label,
+                  const Label<ResourceType>& backward_label) {
+            ++nb_joins_;
+
+            const auto& suffix_arcs = get_suffix_arcs(backward_label);
+            if (suffix_arcs.empty()) {
+                return;
+            }
+
+            const Label<ResourceType>* current_label_ptr = &forward_label;
+            Label<ResourceType>* joined_label_ptr = nullptr;
+            for (const auto* arc_ptr : suffix_arcs) {
+                auto& next_label = this->label_pool_.get_next_label(arc_ptr->destination);
+                current_label_ptr->extend(*arc_ptr, &next_label);
+                if (joined_label_ptr != nullptr) {
+                    this->label_pool_.release_label(joined_label_ptr);
+                }
+                joined_label_ptr = &next_label;
+                current_label_ptr = joined_label_ptr;
+
+                if (!joined_label_ptr->is_feasible()) {
+                    this->label_pool_.release_label(joined_label_ptr);
+                    return;
+                }
+            }
+
+            double cost = joined_label_ptr->get_cost();
+            this->label_pool_.release_label(joined_label_ptr);
+            if (cost >= this->cost_upper_bound_) {
+                return;
+            }
+
+            auto prefix_it = prefix_arc_ids_by_label_.find(&forward_label);
+            if (prefix_it == prefix_arc_ids_by_label_.end()) {
+                prefix_it =
+                    prefix_arc_ids_by_label_
+                        .emplace(&forward_label, forward_->get_path_arc_ids(forward_label))
+                        .first;
+            }
+
+            if (prefix_it->second.empty() && forward_label.get_in_arc() != nullptr) {
+                return;
+            }
+
+            auto path_arc_ids = prefix_it->second;
+            for (const auto* arc_ptr : suffix_arcs) {
+                path_arc_ids.push_back(arc_ptr->id);
+            }
+            this->add_solution(cost, std::move(path_arc_ids));
+        }
+
+        // Forward arcs from the node of the backward label to a sink (empty if not available).
+        const std::vector<const Arc<ResourceType>*>& get_suffix_arcs(
+            const Label<ResourceType>& backward_label) {
+            auto suffix_it = suffix_arcs_by_label_.find(&backward_label);
+            if (suffix_it != suffix_arcs_by_label_.end()) {
+                return suffix_it->second;
+            }
+
+            std::vector<const Arc<ResourceType>*> suffix_arcs;
+            auto backward_arc_ids = backward_->get_path_arc_ids(backward_label);
+            for (auto arc_id_it = backward_arc_ids.rbegin(); arc_id_it != backward_arc_ids.rend();
+                 ++arc_id_it) {
+                // the arc may have been removed from the forward graph by the preprocessing
+                const auto* arc_ptr = this->graph_->get_arc(*arc_id_it);
+                if (arc_ptr == nullptr || this->is_arc_removed(*arc_ptr)) {
+                    suffix_arcs.clear();
+                    break;
+                }
+                suffix_arcs.push_back(arc_ptr);
+            }
+
+            return suffix_arcs_by_label_.emplace(&backward_label, std::move(suffix_arcs))
+                .first->second;
+        }
+
+        Graph<ResourceType>* backward_graph_;
+
+        std::unique_ptr<HalfwayDominanceAlgorithm<ResourceType>> forward_;
+        std::unique_ptr<HalfwayDominanceAlgorithm<ResourceType>> backward_;
+
+        JoinCompatibilityFunction<ResourceType> are_compatible_;
+
+        std::unordered_map<const Label<ResourceType>*, std::list<size_t>> prefix_arc_ids_by_label_;
+        std::unordered_map<const Label<ResourceType>*, std::vector<const Arc<ResourceType>*>>
+            suffix_arcs_by_label_;
+
+        size_t nb_joins_ = 0;
+        size_t nb_incompatible_joins_ = 0;
+};
+}  // namespace rcspp
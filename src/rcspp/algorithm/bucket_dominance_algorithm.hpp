@@ -0,0 +1,208 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "rcspp/algorithm/dominance_algorithm.hpp"
+
+namespace rcspp {
+
+// Value of the resource used to assign the labels to buckets.
+template <typename ResourceType>
+using BucketResourceFunction = std::function<double(const Resource<ResourceType>&)>;
+
+/**
+ * @brief BucketDominanceAlgorithm: labeling algorithm on a bucket graph for RCSPP.
+ *
+ * The labels are assigned to buckets of a given size according to the value of a monotone
+ * resource (e.g., the time), which must also be a dominance criterion: a label can only dominate
+ * labels with a greater or equal value of this resource. At each node, the non-dominated labels are
+ * stored by bucket, so that a new label is only compared with the labels of the buckets with a
+ * lower or equal value (dominating labels) and with a greater or equal value (dominated labels).
+ * The unprocessed labels are processed in increasing bucket order instead of a FIFO order.
+ *
+ * Truncation (num_labels_to_extend_by_node) is not supported.
+ */
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class BucketDominanceAlgorithm : public DominanceAlgorithm<ResourceType> {
+    public:
+        BucketDominanceAlgorithm(ResourceFactory<ResourceType>* resource_factory,
+                                 AlgorithmParams params,
+                                 BucketResourceFunction<ResourceType> bucket_resource,
+                                 double bucket_size)
+            : DominanceAlgorithm<ResourceType>(resource_factory, std::move(params)),
+              bucket_resource_(std::move(bucket_resource)),
+              bucket_size_(bucket_size) {
+            if (bucket_size_ <= 0) {
+                LOG_FATAL("BucketDominanceAlgorithm: the bucket size must be positive.\n");
+                throw std::runtime_error(
+                    "BucketDominanceAlgorithm: the bucket size must be positive.");
+            }
+            if (this->params_.num_labels_to_extend_by_node < MAX_INT) {
+                LOG_WARN(
+                    "BucketDominanceAlgorithm: num_labels_to_extend_by_node is not supported "
+                    "and will be ignored.\n");
+            }
+        }
+
+        ~BucketDominanceAlgorithm() override = default;
+
+        [[nodiscard]] size_t get_memory_usage() const override {
+            size_t memory_usage = DominanceAlgorithm<ResourceType>::get_memory_usage();
+            for (const auto& labels_by_bucket : labels_by_bucket_by_node_pos_) {
+                for (const auto& [bucket, labels] : labels_by_bucket) {
+                    memory_usage += labels.get_memory_usage();
+                }
+            }
+            return memory_usage;
+        }
+
+    private:
+        using BucketIndex = int64_t;
+
+        void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
+            // keep the buckets (and their memory) from one solve to the next
+            labels_by_bucket_by_node_pos_.resize(graph->get_number_of_nodes());
+            for (auto& labels_by_bucket : labels_by_bucket_by_node_pos_) {
+                for (auto& [bucket, labels] : labels_by_bucket) {
+                    labels.clear();
+                }
+            }
+            unprocessed_labels_by_bucket_.clear();
+            num_unprocessed_labels_ = 0;
+
+            DominanceAlgorithm<ResourceType>::initialize(graph, cost_upper_bound);
+        }
+
+        Label<ResourceType>* next_label() override {
+            while (!unprocessed_labels_by_bucket_.empty()) {
+                // lowest bucket first
+                auto bucket_it = unprocessed_labels_by_bucket_.begin();
+                auto& labels = bucket_it->second;
+                if (labels.empty()) {
+                    unprocessed_labels_by_bucket_.erase(bucket_it);
+                    continue;
+                }
+
+                auto* label_ptr = labels.back();
+                labels.pop_back();
+                --num_unprocessed_labels_;
+
+                if (!label_ptr->dominated) {
+                    return label_ptr;
+                }
+                this->label_pool_.release_label(label_ptr);
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] size_t number_of_labels() const override { return num_unprocessed_labels_; }
+
+        void add_new_unprocessed_label(Label<ResourceType>* label_ptr) override {
+            unprocessed_labels_by_bucket_[get_bucket(*label_ptr)].push_back(label_ptr);
+            ++num_unprocessed_labels_;
+        }
+
+        void insert_non_dominated_label(Label<ResourceType>* label_ptr) override {
+            labels_by_bucket_by_node_pos_.at(label_ptr->get_end_node()->pos())[get_bucket(
+                                                                                 *label_ptr)]
+                .insert(label_ptr);
+        }
+
+        bool update_non_dominated_labels(const Label<ResourceType>& label) override {
+            this->total_update_non_dom_time_.start();
+            ++this->nb_update_non_dom_iter_;
+
+            auto& labels_by_bucket = labels_by_bucket_by_node_pos_.at(label.get_end_node()->pos());
+            const double value = bucket_resource_(label.get_resource());
+
+            // First, check the buckets that may contain a dominating label (lower or equal value)
+            const auto last_dominating_it =
+                labels_by_bucket.upper_bound(get_bucket(value + RESOURCE_EPSILON));
+            for (auto it = labels_by_bucket.begin(); it != last_dominating_it; ++it) {
+                if (this->is_dominated(it->second, label)) {
+                    this->total_update_non_dom_time_.stop();
+                    return false;
+                }
+            }
+
+            // Second, remove the dominated labels of the buckets with a greater or equal value
+            for (auto it = labels_by_bucket.lower_bound(get_bucket(value - RESOURCE_EPSILON));
+                 it != labels_by_bucket.end();
+                 ++it) {
+                this->remove_dominated_labels(&it->second, label);
+            }
+
+            this->total_update_non_dom_time_.stop();
+
+            return true;
+        }
+
+        [[nodiscard]] bool has_cheaper_label(const Label<ResourceType>& label) const override {
+            return std::ranges::any_of(
+                labels_by_bucket_by_node_pos_.at(label.get_end_node()->pos()),
+                [&label](const auto& bucket_labels) {
+                    return bucket_labels.second.has_cost_leq(label.get_cost());
+                });
+        }
+
+        void remove_label(const Label<ResourceType>* label_ptr) override {
+            auto& labels_by_bucket =
+                labels_by_bucket_by_node_pos_.at(label_ptr->get_end_node()->pos());
+            auto it = labels_by_bucket.find(get_bucket(*label_ptr));
+            if (it != labels_by_bucket.end()) {
+                it->second.erase(label_ptr);
+            }
+        }
+
+        [[nodiscard]] std::list<Label<ResourceType>*> get_labels_at_sinks() const override {
+            std::list<Label<ResourceType>*> labels_at_sinks;
+            for (auto sink_node_id : this->graph_->get_sink_node_ids()) {
+                auto node_pos = this->graph_->get_node(sink_node_id)->pos();
+                for (const auto& [bucket, labels] : labels_by_bucket_by_node_pos_.at(node_pos)) {
+                    for (auto* label_ptr : labels) {
+                        labels_at_sinks.push_back(label_ptr);
+                    }
+                }
+            }
+
+            return labels_at_sinks;
+        }
+
+        [[nodiscard]] BucketIndex get_bucket(double value) const {
+            if (!std::isfinite(value)) {
+                return value > 0 ? std::numeric_limits<BucketIndex>::max()
+                                 : std::numeric_limits<BucketIndex>::min();
+            }
+            return static_cast<BucketIndex>(std::floor(value / bucket_size_));
+        }
+
+        [[nodiscard]] BucketIndex get_bucket(const Label<ResourceType>& label) const {
+            return get_bucket(bucket_resource_(label.get_resource()));
+        }
+
+        // Tolerance of the dominance on the bucket resource (see value_leq).
+        static constexpr double RESOURCE_EPSILON = std::numeric_limits<double>::epsilon();
+
+        BucketResourceFunction<ResourceType> bucket_resource_;
+        double bucket_size_;
+
+        // non-dominated labels of each node, by bucket
+        std::vector<std::map<BucketIndex, LabelBucket<ResourceType>>> labels_by_bucket_by_node_pos_;
+
+        // unprocessed labels, by bucket
+        std::map<BucketIndex, std::vector<Label<ResourceType>*>> unprocessed_labels_by_bucket_;
+        size_t num_unprocessed_labels_ = 0;
+};
+}  // namespace rcspp
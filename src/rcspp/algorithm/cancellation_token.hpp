@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace rcspp {
+
+/**
+ * @brief Token to cancel running solves from another thread (see AlgorithmParams).
+ *
+ * The copies of a token share the same state: cancelling any of them cancels all the solves using
+ * one of the copies. A cancelled solve returns the solutions found so far and is not optimal. The
+ * token stays cancelled until reset.
+ */
+class CancellationToken {
+    public:
+        CancellationToken() : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+        void cancel() { cancelled_->store(true, std::memory_order_relaxed); }
+
+        void reset() { cancelled_->store(false, std::memory_order_relaxed); }
+
+        [[nodiscard]] bool is_cancelled() const {
+            return cancelled_->load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+}  // namespace rcspp
@@ -59,12 +59,23 @@ class DiversificationSearch : public Algorithm<ResourceType> {
 
         [[nodiscard]] bool is_optimal() const override { return false; }
 
+        // The wrapped algorithm shares its solutions too, and stops with the search.
+        void set_shared_state(SharedSearchState* shared_state) override {
+            Algorithm<ResourceType>::set_shared_state(shared_state);
+            algo_->set_shared_state(shared_state);
+        }
+
         // Run diversification search using tabu-based strategy and collect solutions. The search
         // runs up to max_iterations or stop_after_X_solutions.
     protected:
         void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
             Algorithm<ResourceType>::initialize(graph, cost_upper_bound);
             graph_copy_ = std::move(graph->clone());
+            for (const auto& arc_id : graph_copy_->get_arc_ids()) {
+                if (this->get_arc_mask().is_removed(arc_id)) {
+                    graph_copy_->remove_arc(arc_id);
+                }
+            }
         }
         void main_loop() override {
             // check stopping criteria
@@ -76,9 +87,16 @@ class DiversificationSearch : public Algorithm<ResourceType> {
                 return;
             }
 
+            // the wrapped algorithm stops at the deadline of the search
+            algo_->set_deadline(this->deadline_);
+
             size_t i = 0;
             while (i < this->params_.max_iterations &&
                    this->solutions_.size() < this->params_.stop_after_X_solutions) {
+                if (this->must_stop()) {
+                    LOG_DEBUG("Stopping on request.\n");
+                    break;
+                }
                 ++i;
 
                 // solve (important to clear the label pool, as the graph is changing)
@@ -93,13 +111,10 @@ class DiversificationSearch : public Algorithm<ResourceType> {
                 for (auto& sol : sols) {
                     // make tabu
                     tabu_solution(sol);
-                    // check if we found the solution
-                    if (this->solutions_.contains(sol)) {
-                        continue;
+                    // add the solution (if not found yet)
+                    if (this->add_solution(std::move(sol))) {
+                        added = true;
                     }
-                    // then add the solution
-                    this->solutions_.insert(std::move(sol));
-                    added = true;
                 }
 
                 // increase tenure
@@ -5,11 +5,15 @@
 
 #include <algorithm>
 #include <list>
+#include <ranges>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "rcspp/algorithm/algorithm.hpp"
+#include "rcspp/label/label_bucket.hpp"
 #include "rcspp/label/label_pool.hpp"
+#include "rcspp/resource/concrete/numerical_resource.hpp"
 
 namespace rcspp {
 
@@ -20,39 +24,53 @@ class DominanceAlgorithm : public Algorithm<ResourceType> {
         DominanceAlgorithm(ResourceFactory<ResourceType>* resource_factory, AlgorithmParams params)
             : Algorithm<ResourceType>(resource_factory, std::move(params)) {}
 
+        [[nodiscard]] size_t get_memory_usage() const override {
+            size_t memory_usage = Algorithm<ResourceType>::get_memory_usage();
+            for (const auto& labels : non_dominated_labels_by_node_pos_) {
+                memory_usage += labels.get_memory_usage();
+            }
+            return memory_usage;
+        }
+
     protected:
         void initialize_labels() override {
-            non_dominated_labels_by_node_pos_.clear();
-            for (size_t i = 0; i < this->graph_->get_number_of_nodes(); i++) {
-                non_dominated_labels_by_node_pos_.push_back(std::list<Label<ResourceType>*>());
+            // cold solve: the labels at the sinks of the previous solve are released
+            warm_start_labels_at_sinks_.clear();
+
+            // keep the memory of the buckets from one solve to the next
+            non_dominated_labels_by_node_pos_.resize(this->graph_->get_number_of_nodes());
+            for (auto& labels : non_dominated_labels_by_node_pos_) {
+                labels.clear();
             }
 
             for (auto source_node_id : this->graph_->get_source_node_ids()) {
                 auto* source_node = this->graph_->get_node(source_node_id);
                 auto& label = this->label_pool_.get_next_label(source_node);
 
-                auto& labels = non_dominated_labels_by_node_pos_.at(source_node->pos());
-                // it points to the newly inserted element
-                auto label_it = labels.insert(labels.end(), &label);
-                add_new_unprocessed_label(std::make_pair(&label, label_it));
+                insert_non_dominated_label(&label);
+                add_new_unprocessed_label(&label);
             }
         }
 
         void main_loop() override {
             size_t i = 0;
             while (this->number_of_labels() > 0 && i < this->params_.max_iterations) {
+                if (this->must_stop()) {
+                    LOG_DEBUG("Stopping on request.\n");
+                    break;
+                }
                 ++i;
 
                 // next label to process
-                auto label_iterator_pair = next_label_iterator();
+                auto* label_ptr = next_label();
 
                 // no more label -> break (useful when pulling)
-                if (label_iterator_pair.first == nullptr) {
+                if (label_ptr == nullptr) {
                     break;
                 }
 
                 // label dominated -> continue to next one
-                auto& label = *label_iterator_pair.first;
+                auto& label = *label_ptr;
                 if (label.dominated) {
                     this->label_pool_.release_label(&label);
                     continue;
@@ -63,7 +81,7 @@ class DominanceAlgorithm : public Algorithm<ResourceType> {
                 // check if we can update the best label or extend
                 if (label.get_end_node()->sink) {
                     if (label.get_cost() < this->cost_upper_bound_ &&
-                        this->params_.return_dominated_solutions) {
+                        (this->params_.return_dominated_solutions || this->is_streamed(label))) {
                         this->extract_solution(label);
                         if (this->solutions_.size() >= this->params_.stop_after_X_solutions) {
                             LOG_DEBUG("Stopping after ", this->solutions_.size(), " solutions.\n");
@@ -75,7 +93,7 @@ class DominanceAlgorithm : public Algorithm<ResourceType> {
                     this->extend(&label);
                     this->total_full_extend_time_.stop();
                 } else {
-                    remove_label(label_iterator_pair.second);
+                    remove_label(&label);
                     this->label_pool_.release_label(&label);
                 }
             }
@@ -83,12 +101,15 @@ class DominanceAlgorithm : public Algorithm<ResourceType> {
             LOG_DEBUG("RCSPP: WHILE nb iter: ", i, "\n");
         }
 
-        virtual LabelIteratorPair<ResourceType> next_label_iterator() = 0;
+        // Return the next label to process (nullptr if none).
+        virtual Label<ResourceType>* next_label() = 0;
 
         virtual void extend(Label<ResourceType>* label_ptr) {
             const auto& current_node = label_ptr->get_end_node();
             for (auto arc_ptr : current_node->out_arcs) {
-                extend_label(label_ptr, arc_ptr);
+                if (!this->is_arc_removed(*arc_ptr)) {
+                    extend_label(label_ptr, arc_ptr);
+                }
             }
         }
 
@@ -98,15 +119,19 @@ class DominanceAlgorithm : public Algorithm<ResourceType> {
             label_ptr->extend(*arc_ptr, &new_label);
 
             bool feasible = new_label.is_feasible();
-            if (feasible && update_non_dominated_labels(new_label)) {
+            if (feasible && this->exceeds_upper_bound(new_label)) {
+                // cannot lead to a solution cheaper than the upper bound
+                ++nb_pruned_labels_;
+                this->label_pool_.release_label(&new_label);
+            } else if (feasible && this->is_over_label_budget() && has_cheaper_label(new_label)) {
+                // degraded by the label budget: only the cheapest labels of the nodes are kept
+                ++nb_budget_dropped_labels_;
+                this->label_pool_.release_label(&new_label);
+            } else if (feasible && update_non_dominated_labels(new_label)) {
                 // Add to unprocessed_labels_ and non_dominated_labels_by_node_id_ only if
                 // feasible and non dominated.
-                auto& non_dominated_labels =
-                    non_dominated_labels_by_node_pos_.at(new_label.get_end_node()->pos());
-                // points to the newly inserted element
-                auto new_label_it =
-                    non_dominated_labels.insert(non_dominated_labels.end(), &new_label);
-                add_new_unprocessed_label(std::make_pair(&new_label, new_label_it));
+                insert_non_dominated_label(&new_label);
+                add_new_unprocessed_label(&new_label);
             } else {
                 if (!feasible) {
                     ++this->nb_infeasible_labels_;
@@ -117,121 +142,168 @@ class DominanceAlgorithm : public Algorithm<ResourceType> {
             }
         }
 
-        std::list<size_t> get_path_arc_ids(const Label<ResourceType>& label) override {
-            std::list<size_t> path_arc_ids;
-
-            auto in_arc_ptr = label.get_in_arc();
-
-            if (in_arc_ptr != nullptr) {
-                path_arc_ids.push_back(in_arc_ptr->id);
-
-                auto prev_node_ptr = in_arc_ptr->origin;
-
-                const Label<ResourceType>* current_label_ptr = &label;
-
-                while (prev_node_ptr != nullptr && !prev_node_ptr->source) {
-                    bool found = false;
-                    for (const auto label_ptr :
-                         non_dominated_labels_by_node_pos_.at(prev_node_ptr->pos())) {
-                        auto& next_label_ref =
-                            this->label_pool_.get_next_label(in_arc_ptr->destination);
-                        label_ptr->extend(*in_arc_ptr, &next_label_ref);
-
-                        if (next_label_ref <= *current_label_ptr) {
-                            current_label_ptr = label_ptr;
-                            found = true;
-                            break;
-                        }
-                    }
+        bool update_labels_at_sinks() override {
+            // all the labels at the sinks of the last cold solve are re-evaluated at each warm
+            // solve: a label dominated under the previous resources of the arcs may be the best one
+            // under the current ones
+            if (warm_start_labels_at_sinks_.empty()) {
+                auto labels_at_sinks = this->get_labels_at_sinks();
+                warm_start_labels_at_sinks_.assign(labels_at_sinks.begin(), labels_at_sinks.end());
+            }
+            for (auto* label_ptr : warm_start_labels_at_sinks_) {
+                remove_label(label_ptr);
+            }
 
-                    if (!found) {
-                        LOG_ERROR("Error while extracting path: could not find previous label.\n");
-                        return {};
-                    }
+            // the labels at the sinks and their ancestors, updated from the sources: the ancestors
+            // of each label at a sink that are not updated yet are updated parent first (the ids
+            // of the labels do not give their creation order when they come from several pools,
+            // e.g., in ParallelDominanceAlgorithm)
+            std::vector<Label<ResourceType>*> labels;
+            std::unordered_set<const Label<ResourceType>*> updated_labels;
+            for (const auto* sink_label : warm_start_labels_at_sinks_) {
+                labels.clear();
+                for (const auto* label_ptr = sink_label;
+                     label_ptr != nullptr && updated_labels.insert(label_ptr).second;
+                     label_ptr = label_ptr->get_parent()) {
+                    // the labels are owned by the pool: they can be modified
+                    labels.push_back(const_cast<Label<ResourceType>*>(label_ptr));  // NOLINT
+                }
+                for (auto* label_ptr : std::views::reverse(labels)) {
+                    label_ptr->update_from_parent();
+                }
+            }
 
-                    in_arc_ptr = current_label_ptr->get_in_arc();
-                    if (in_arc_ptr != nullptr) {
-                        path_arc_ids.push_back(in_arc_ptr->id);
-                        prev_node_ptr = in_arc_ptr->origin;
-                    } else {
-                        prev_node_ptr = nullptr;
-                    }
+            // dominance between the updated labels at the sinks, cheapest first: it only selects
+            // the labels returned by this solve, all of them are kept for the next warm solves
+            auto labels_at_sinks = warm_start_labels_at_sinks_;
+            std::ranges::stable_sort(labels_at_sinks,
+                                     [](const Label<ResourceType>* l1,
+                                        const Label<ResourceType>* l2) {
+                                         return l1->get_cost() < l2->get_cost();
+                                     });
+            for (auto* label_ptr : labels_at_sinks) {
+                label_ptr->dominated = false;
+            }
+            for (auto* label_ptr : labels_at_sinks) {
+                // the labels dominated by a cheaper one are marked as dominated (but kept)
+                if (label_ptr->is_feasible() && update_non_dominated_labels(*label_ptr)) {
+                    insert_non_dominated_label(label_ptr);
+                } else {
+                    label_ptr->dominated = true;
                 }
             }
 
-            std::ranges::reverse(path_arc_ids);
+            return true;
+        }
+
+        std::list<size_t> get_path_arc_ids(const Label<ResourceType>& label) override {
+            // follow the parents back to the source
+            std::list<size_t> path_arc_ids;
+            for (const auto* label_ptr = &label; label_ptr->get_in_arc() != nullptr;
+                 label_ptr = label_ptr->get_parent()) {
+                path_arc_ids.push_front(label_ptr->get_in_arc()->id);
+            }
 
             return path_arc_ids;
         }
 
+        virtual void insert_non_dominated_label(Label<ResourceType>* label_ptr) {
+            non_dominated_labels_by_node_pos_.at(label_ptr->get_end_node()->pos())
+                .insert(label_ptr);
+        }
+
         virtual bool update_non_dominated_labels(const Label<ResourceType>& label) {
             total_update_non_dom_time_.start();
             ++nb_update_non_dom_iter_;
 
             auto current_node_pos = label.get_end_node()->pos();
-            auto& non_dominated_labels_list =
-                non_dominated_labels_by_node_pos_.at(current_node_pos);
+            auto& non_dominated_labels = non_dominated_labels_by_node_pos_.at(current_node_pos);
 
             // First, check if label is dominated by any existing non-dominated label
-            bool label_dominated = false;
-            for (const auto non_dominated_label_ptr : non_dominated_labels_list) {
-                if (&label == non_dominated_label_ptr) {
-                    continue;
-                }
-                if ((*non_dominated_label_ptr) <= label) {
-                    label_dominated = true;
-                    break;
-                }
-            }
-            if (label_dominated) {
+            if (is_dominated(non_dominated_labels, label)) {
                 total_update_non_dom_time_.stop();
                 return false;
             }
 
             // Second, remove all existing non-dominated labels that are dominated by label
-            for (auto non_dominated_label_it = non_dominated_labels_list.begin();
-                 non_dominated_label_it != non_dominated_labels_list.end();) {
-                if (&label != *non_dominated_label_it && label <= *(*non_dominated_label_it)) {
-                    (*non_dominated_label_it)->dominated = true;
-                    non_dominated_label_it =
-                        non_dominated_labels_list.erase(non_dominated_label_it);
-                } else {
-                    ++non_dominated_label_it;
-                }
-            }
+            remove_dominated_labels(&non_dominated_labels, label);
 
             total_update_non_dom_time_.stop();
 
             return true;
         }
 
-        virtual void remove_label(const std::list<Label<ResourceType>*>::iterator& label_iterator) {
-            auto current_node_pos = (*label_iterator)->get_end_node()->pos();
-            non_dominated_labels_by_node_pos_.at(current_node_pos).erase(label_iterator);
+        // Whether a non-dominated label at the node of the label has a lower or equal cost.
+        [[nodiscard]] virtual bool has_cheaper_label(const Label<ResourceType>& label) const {
+            return non_dominated_labels_by_node_pos_.at(label.get_end_node()->pos())
+                .has_cost_leq(label.get_cost());
+        }
+
+        // Check if the label is dominated by a label of the bucket. A label can only be dominated
+        // by a label with a lower or equal cost and a compatible signature: the other labels are
+        // skipped without being dereferenced (see LabelBucket), and the full dominance check is
+        // skipped when the signatures decide it (see DominanceSignature::decides).
+        static bool is_dominated(const LabelBucket<ResourceType>& labels,
+                                 const Label<ResourceType>& label) {
+            const auto& signature = label.get_dominance_signature();
+            return labels.any_dominating_candidate(
+                label.get_cost(),
+                signature,
+                [&label, &signature](const auto& entry) {
+                    return entry.label != &label &&
+                           (entry.signature.decides(signature) || *entry.label <= label);
+                });
+        }
+
+        // Mark as dominated and remove the labels of the bucket dominated by the label.
+        static void remove_dominated_labels(LabelBucket<ResourceType>* labels,
+                                            const Label<ResourceType>& label) {
+            const auto& signature = label.get_dominance_signature();
+            labels->erase_dominated_candidates_if(
+                label.get_cost(),
+                signature,
+                [&label, &signature](const auto& entry) {
+                    if (entry.label != &label &&
+                        (signature.decides(entry.signature) || label <= *entry.label)) {
+                        entry.label->dominated = true;
+                        return true;
+                    }
+                    return false;
+                });
+            labels->compact_if_needed();
+        }
+
+        virtual void remove_label(const Label<ResourceType>* label_ptr) {
+            auto current_node_pos = label_ptr->get_end_node()->pos();
+            non_dominated_labels_by_node_pos_.at(current_node_pos).erase(label_ptr);
         }
 
         [[nodiscard]] std::list<Label<ResourceType>*> get_labels_at_sinks() const override {
             std::list<Label<ResourceType>*> labels_at_sinks;
             for (auto sink_node_id : this->graph_->get_sink_node_ids()) {
                 auto node_pos = this->graph_->get_node(sink_node_id)->pos();
-                const auto& labels_at_current_sink = non_dominated_labels_by_node_pos_.at(node_pos);
-                labels_at_sinks.insert(labels_at_sinks.end(),
-                                       labels_at_current_sink.begin(),
-                                       labels_at_current_sink.end());
+                for (auto* label_ptr : non_dominated_labels_by_node_pos_.at(node_pos)) {
+                    labels_at_sinks.push_back(label_ptr);
+                }
             }
 
             return labels_at_sinks;
         }
 
-        virtual void add_new_unprocessed_label(
-            const LabelIteratorPair<ResourceType>& label_iterator_pair) = 0;
+        virtual void add_new_unprocessed_label(Label<ResourceType>* label_ptr) = 0;
+
+        std::vector<LabelBucket<ResourceType>> non_dominated_labels_by_node_pos_;
 
-        std::vector<std::list<Label<ResourceType>*>> non_dominated_labels_by_node_pos_;
+        // labels at the sinks of the last cold solve, re-evaluated by each warm solve (see
+        // update_labels_at_sinks)
+        std::vector<Label<ResourceType>*> warm_start_labels_at_sinks_;
 
         Timer total_extend_time_;
         Timer total_update_non_dom_time_;
 
         size_t nb_infeasible_labels_ = 0;
+        size_t nb_pruned_labels_ = 0;
+        size_t nb_budget_dropped_labels_ = 0;
         size_t nb_update_non_dom_iter_ = 0;
         size_t nb_extend_iter_ = 0;
 };
@@ -242,9 +314,9 @@ struct NodeUnprocessedLabelsManager {
             if (unprocessed_labels_by_node_pos_.empty()) {
                 for (size_t i = 0; i < num_nodes; i++) {
                     unprocessed_labels_by_node_pos_.push_back(
-                        std::list<LabelIteratorPair<ResourceType>>());
+                        std::list<Label<ResourceType>*>());
                     truncated_unprocessed_labels_by_node_pos_.push_back(
-                        std::list<LabelIteratorPair<ResourceType>>());
+                        std::list<Label<ResourceType>*>());
                 }
             }
             // save unprocessed labels for the current node
@@ -256,13 +328,27 @@ struct NodeUnprocessedLabelsManager {
             this->current_unprocessed_labels_ = std::move(unprocessed_labels_by_node_pos_.at(0));
         }
 
-        void add_new_label(const LabelIteratorPair<ResourceType>& label_iterator_pair) {
+        // Forget the labels left by the previous solve (e.g., if it was stopped early): they are
+        // released with the label pool.
+        void clear_unprocessed_labels() {
+            for (auto& labels : unprocessed_labels_by_node_pos_) {
+                labels.clear();
+            }
+            for (auto& labels : truncated_unprocessed_labels_by_node_pos_) {
+                labels.clear();
+            }
+            current_unprocessed_labels_.clear();
+            current_unprocessed_node_pos_ = 0;
+            num_unprocessed_labels_ = 0;
+        }
+
+        void add_new_label(Label<ResourceType>* label_ptr) {
             assert(check_number_of_unprocessed_labels());
-            size_t pos = label_iterator_pair.first->get_end_node()->pos();
+            size_t pos = label_ptr->get_end_node()->pos();
             if (pos == current_unprocessed_node_pos_) {
-                current_unprocessed_labels_.push_back(label_iterator_pair);
+                current_unprocessed_labels_.push_back(label_ptr);
             } else {
-                unprocessed_labels_by_node_pos_.at(pos).push_back(label_iterator_pair);
+                unprocessed_labels_by_node_pos_.at(pos).push_back(label_ptr);
             }
             ++num_unprocessed_labels_;
         }
@@ -275,7 +361,7 @@ struct NodeUnprocessedLabelsManager {
         }
 
         void resize_unprocessed_labels(
-            std::list<LabelIteratorPair<ResourceType>>* unprocessed_labels, size_t new_size,
+            std::list<Label<ResourceType>*>* unprocessed_labels, size_t new_size,
             LabelPool<ResourceType>* label_pool, bool sort) {
             int num_exceeding_labels = unprocessed_labels->size() - new_size;
             if (num_exceeding_labels <= 0) {
@@ -284,25 +370,25 @@ struct NodeUnprocessedLabelsManager {
 
             if (sort) {
                 // sort labels by cost (ascending)
-                unprocessed_labels->sort([](const LabelIteratorPair<ResourceType>& p1,
-                                            const LabelIteratorPair<ResourceType>& p2) {
+                unprocessed_labels->sort([](const Label<ResourceType>* l1,
+                                            const Label<ResourceType>* l2) {
                     // either both dominated or both non-dominated
-                    if (p1.first->dominated == p2.first->dominated) {
-                        return p1.first->get_cost() < p2.first->get_cost();  // lower cost first
+                    if (l1->dominated == l2->dominated) {
+                        return l1->get_cost() < l2->get_cost();  // lower cost first
                     }
-                    return !p1.first->dominated;  // non-dominated first
+                    return !l1->dominated;  // non-dominated first
                 });
             }
 
             // release the exceeding labels
             size_t i = 0;
-            for (auto& p : *unprocessed_labels) {
+            for (auto& label_ptr : *unprocessed_labels) {
                 if (i++ >= new_size) {
-                    if (p.first->dominated && label_pool) {
-                        label_pool->release_label(p.first);
-                        p.first = nullptr;
+                    if (label_ptr->dominated && label_pool) {
+                        label_pool->release_label(label_ptr);
+                        label_ptr = nullptr;
                     } else {
-                        store_truncated_unprocessed_label(p);
+                        store_truncated_unprocessed_label(label_ptr);
                     }
                 }
             }
@@ -313,11 +399,9 @@ struct NodeUnprocessedLabelsManager {
             assert(check_number_of_unprocessed_labels());
         }
 
-        void store_truncated_unprocessed_label(
-            LabelIteratorPair<ResourceType> label_iterator_pair) {
-            truncated_unprocessed_labels_by_node_pos_
-                .at(label_iterator_pair.first->get_end_node()->pos())
-                .push_back(std::move(label_iterator_pair));
+        void store_truncated_unprocessed_label(Label<ResourceType>* label_ptr) {
+            truncated_unprocessed_labels_by_node_pos_.at(label_ptr->get_end_node()->pos())
+                .push_back(label_ptr);
         }
 
         void restore_truncated_unprocessed_labels() {
@@ -352,9 +436,9 @@ struct NodeUnprocessedLabelsManager {
         size_t num_unprocessed_labels_ = 0;
         size_t current_unprocessed_node_pos_ = 0;
         size_t num_loops_ = 0;
-        std::list<LabelIteratorPair<ResourceType>> current_unprocessed_labels_;
-        std::vector<std::list<LabelIteratorPair<ResourceType>>> unprocessed_labels_by_node_pos_;
-        std::vector<std::list<LabelIteratorPair<ResourceType>>>
+        std::list<Label<ResourceType>*> current_unprocessed_labels_;
+        std::vector<std::list<Label<ResourceType>*>> unprocessed_labels_by_node_pos_;
+        std::vector<std::list<Label<ResourceType>*>>
             truncated_unprocessed_labels_by_node_pos_;
 };
 }  // namespace rcspp
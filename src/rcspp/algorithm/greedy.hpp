@@ -37,6 +37,10 @@ class GreedyAlgorithm : public Algorithm<ResourceType> {
         void main_loop() override {
             size_t i = 0;
             while (this->number_of_labels() > 0 && i < this->params_.max_iterations) {
+                if (this->must_stop()) {
+                    LOG_DEBUG("Stopping on request.\n");
+                    break;
+                }
                 ++i;
 
                 // get the label
@@ -118,6 +122,9 @@ class GreedyAlgorithm : public Algorithm<ResourceType> {
             auto* end_node = label->get_end_node();
             std::list<Label<ResourceType>*> all_labels;
             for (auto* arc : end_node->out_arcs) {
+                if (this->is_arc_removed(*arc)) {
+                    continue;
+                }
                 // extend along arc
                 auto& new_label = this->label_pool_.get_next_label(arc->destination);
                 label->extend(*arc, &new_label);
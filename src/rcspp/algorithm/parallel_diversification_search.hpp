@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "rcspp/algorithm/algorithm.hpp"
+#include "rcspp/algorithm/diversification_search.hpp"
+#include "rcspp/algorithm/portfolio_algorithm.hpp"
+
+namespace rcspp {
+
+template <typename ResourceType>
+using AlgorithmMaker = std::function<std::unique_ptr<Algorithm<ResourceType>>()>;
+
+/**
+ * @brief ParallelDiversificationSearch: runs several independent DiversificationSearch
+ * trajectories concurrently.
+ *
+ * Each trajectory runs in its own thread, on its own copy of the graph (with its own tabu arcs),
+ * with the seed params.seed + its index, so that the random noise on the tabu tenures makes the
+ * trajectories diverge (see AlgorithmParams::tabu_random_noise). The distinct solutions of all the
+ * trajectories are merged (by Solution::get_hash()), and the search stops once they have found
+ * stop_after_X_solutions distinct solutions together. The best cost is not shared: each trajectory
+ * keeps looking for diverse solutions below the upper bound.
+ *
+ * Usage: construct with a resource factory, algorithm parameters (num_threads is the number of
+ * trajectories, 0 for the number of hardware threads, max_iterations must be finite) and,
+ * optionally, a function that creates the algorithm wrapped by each trajectory (a GreedyAlgorithm
+ * by default, see DiversificationSearch).
+ */
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class ParallelDiversificationSearch : public PortfolioAlgorithm<ResourceType> {
+    public:
+        ParallelDiversificationSearch(ResourceFactory<ResourceType>* resource_factory,
+                                      AlgorithmParams params,
+                                      AlgorithmMaker<ResourceType> make_algo = nullptr)
+            : PortfolioAlgorithm<ResourceType>(
+                  resource_factory, params,
+                  make_trajectories(resource_factory, params, make_algo), false) {}
+
+        ~ParallelDiversificationSearch() override = default;
+
+        [[nodiscard]] bool is_optimal() const override { return false; }
+
+    private:
+        static std::vector<std::unique_ptr<Algorithm<ResourceType>>> make_trajectories(
+            ResourceFactory<ResourceType>* resource_factory, const AlgorithmParams& params,
+            const AlgorithmMaker<ResourceType>& make_algo) {
+            size_t num_trajectories = params.num_threads;
+            if (num_trajectories == 0) {
+                num_trajectories = std::max<size_t>(1, std::thread::hardware_concurrency());
+            }
+
+            std::vector<std::unique_ptr<Algorithm<ResourceType>>> trajectories;
+            trajectories.reserve(num_trajectories);
+            for (size_t t = 0; t < num_trajectories; ++t) {
+                auto trajectory_params = params;
+                trajectory_params.seed = params.seed + static_cast<int>(t);
+                trajectories.push_back(std::make_unique<DiversificationSearch<ResourceType>>(
+                    resource_factory,
+                    std::move(trajectory_params),
+                    make_algo ? make_algo() : nullptr));
+            }
+            return trajectories;
+        }
+};
+}  // namespace rcspp
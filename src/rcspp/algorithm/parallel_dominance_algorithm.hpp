@@ -0,0 +1,304 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "rcspp/algorithm/dominance_algorithm.hpp"
+
+namespace rcspp {
+
+/**
+ * @brief ParallelDominanceAlgorithm: multi-threaded labeling algorithm for RCSPP.
+ *
+ * Each thread owns a label pool and a deque of unprocessed labels. A thread processes the labels
+ * of its own deque (oldest first) and the labels it creates are pushed back into it. When its
+ * deque is empty, a thread steals the most recent labels of the other threads, so that the work is
+ * balanced without any central queue. The non-dominated labels of each node are protected by a
+ * mutex per node: the dominance checks of labels ending at different nodes run concurrently.
+ *
+ * The algorithm is exact and returns the same solutions as the sequential dominance algorithms.
+ * The number of threads is given by AlgorithmParams::num_threads. Truncation
+ * (num_labels_to_extend_by_node) and phases are not supported.
+ *
+ * The workers stop as soon as the solve must stop (see Algorithm::stop_requested). Since they all
+ * read the upper bound, the upper bound shared with other algorithms (see set_shared_state) is only
+ * read once per phase, before the workers start.
+ *
+ * The solutions are streamed (see set_solution_callback) by the worker that finds them, one at a
+ * time: the callback is called from the worker threads while the search goes on, and all the
+ * workers stop once it returns false.
+ */
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class ParallelDominanceAlgorithm : public DominanceAlgorithm<ResourceType> {
+    public:
+        ParallelDominanceAlgorithm(ResourceFactory<ResourceType>* resource_factory,
+                                   AlgorithmParams params)
+            : DominanceAlgorithm<ResourceType>(resource_factory, std::move(params)),
+              num_threads_(this->params_.num_threads > 0
+                               ? this->params_.num_threads
+                               : std::max<size_t>(1, std::thread::hardware_concurrency())) {
+            if (this->params_.num_labels_to_extend_by_node < MAX_INT) {
+                LOG_WARN(
+                    "ParallelDominanceAlgorithm: num_labels_to_extend_by_node is not supported "
+                    "and will be ignored.\n");
+            }
+            if (this->params_.max_num_labels < MAX_INT) {
+                LOG_WARN(
+                    "ParallelDominanceAlgorithm: max_num_labels is not supported and will be "
+                    "ignored.\n");
+            }
+
+            for (size_t t = 0; t < num_threads_; ++t) {
+                label_pools_.push_back(this->label_pool_.clone());
+                work_queues_.push_back(std::make_unique<WorkQueue>());
+            }
+        }
+
+        ~ParallelDominanceAlgorithm() override = default;
+
+        [[nodiscard]] size_t get_memory_usage() const override {
+            size_t memory_usage = DominanceAlgorithm<ResourceType>::get_memory_usage();
+            for (const auto& label_pool : label_pools_) {
+                memory_usage += label_pool->get_memory_usage();
+            }
+            return memory_usage;
+        }
+
+    protected:
+        void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
+            DominanceAlgorithm<ResourceType>::initialize(graph, cost_upper_bound);
+
+            for (auto& label_pool : label_pools_) {
+                label_pool->reset();
+            }
+            for (auto& work_queue : work_queues_) {
+                work_queue->labels.clear();
+            }
+            node_mutexes_ = std::make_unique<std::mutex[]>(graph->get_number_of_nodes());
+            sink_labels_.clear();
+            num_unprocessed_labels_ = 0;
+            num_iterations_ = 0;
+            next_queue_ = 0;
+            stop_ = false;
+        }
+
+        void main_loop() override {
+            // apply the shared upper bound before the workers read it
+            if (this->must_stop()) {
+                return;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads_);
+            for (size_t t = 0; t < num_threads_; ++t) {
+                threads.emplace_back([this, t]() { run_worker(t); });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            // record whether the workers stopped early (time limit, cancellation or request of
+            // another algorithm), so that no new phase starts
+            static_cast<void>(this->must_stop());
+
+            // solutions found at the sinks while labeling (if return_dominated_solutions), those
+            // already streamed are not extracted again
+            for (const auto* sink_label : sink_labels_) {
+                this->extract_solution(*sink_label);
+            }
+
+            LOG_DEBUG("ParallelDominanceAlgorithm: nb iter: ",
+                      num_iterations_.load(),
+                      " with ",
+                      num_threads_,
+                      " threads\n");
+        }
+
+        // Sequential access to the unprocessed labels (only used outside of the main loop).
+        Label<ResourceType>* next_label() override {
+            Label<ResourceType>* label_ptr = nullptr;
+            for (size_t t = 0; t < num_threads_; ++t) {
+                if (pop_label(t, &label_ptr)) {
+                    --num_unprocessed_labels_;
+                    break;
+                }
+            }
+            return label_ptr;
+        }
+
+        [[nodiscard]] size_t number_of_labels() const override { return num_unprocessed_labels_; }
+
+        void add_new_unprocessed_label(Label<ResourceType>* label_ptr) override {
+            // the source labels are distributed among the threads
+            push_label(next_queue_, label_ptr);
+            next_queue_ = (next_queue_ + 1) % num_threads_;
+        }
+
+    private:
+        struct WorkQueue {
+                std::mutex mutex;
+                std::deque<Label<ResourceType>*> labels;
+        };
+
+        void run_worker(size_t thread_id) {
+            size_t nb_failed_steals = 0;
+            while (!stop_ && !this->stop_requested()) {
+                Label<ResourceType>* label_ptr = nullptr;
+                if (!pop_label(thread_id, &label_ptr) && !steal_label(thread_id, &label_ptr)) {
+                    // no more work anywhere: all the labels have been processed
+                    if (num_unprocessed_labels_ == 0) {
+                        break;
+                    }
+                    // wait for the other threads to create new labels
+                    if (++nb_failed_steals > num_threads_) {
+                        std::this_thread::yield();
+                    }
+                    continue;
+                }
+                nb_failed_steals = 0;
+
+                if (++num_iterations_ > this->params_.max_iterations) {
+                    // put it back for a next solve
+                    push_label(thread_id, label_ptr);
+                    --num_unprocessed_labels_;
+                    stop_ = true;
+                    break;
+                }
+
+                process_label(thread_id, label_ptr);
+                // decremented once the new labels have been pushed, so that the other threads
+                // do not stop while new labels may still be created
+                --num_unprocessed_labels_;
+            }
+        }
+
+        void process_label(size_t thread_id, Label<ResourceType>* label_ptr) {
+            auto& label_pool = *label_pools_[thread_id];
+            const auto* node = label_ptr->get_end_node();
+
+            bool release = false;
+            {
+                std::lock_guard<std::mutex> lock(node_mutexes_[node->pos()]);
+                if (label_ptr->dominated) {
+                    release = true;
+                } else if (!node->sink && std::isinf(label_ptr->get_cost())) {
+                    this->non_dominated_labels_by_node_pos_.at(node->pos()).erase(label_ptr);
+                    release = true;
+                }
+            }
+            if (release) {
+                label_pool.release_label(label_ptr);
+                return;
+            }
+
+            if (node->sink) {
+                if (label_ptr->get_cost() < this->cost_upper_bound_) {
+                    std::lock_guard<std::mutex> lock(sink_labels_mutex_);
+                    if (this->is_streamed(*label_ptr)) {
+                        this->extract_solution(*label_ptr);
+                        // the callback requested to stop
+                        if (this->stopped_) {
+                            stop_ = true;
+                        }
+                    }
+                    if (this->params_.return_dominated_solutions) {
+                        sink_labels_.push_back(label_ptr);
+                        if (sink_labels_.size() >= this->params_.stop_after_X_solutions) {
+                            stop_ = true;
+                        }
+                    }
+                }
+                return;
+            }
+
+            for (const auto* arc_ptr : node->out_arcs) {
+                if (this->is_arc_removed(*arc_ptr)) {
+                    continue;
+                }
+                auto& new_label = label_pool.get_next_label(arc_ptr->destination);
+                label_ptr->extend(*arc_ptr, &new_label);
+
+                if (!new_label.is_feasible() || this->exceeds_upper_bound(new_label)) {
+                    label_pool.release_label(&new_label);
+                    continue;
+                }
+
+                if (insert_if_non_dominated(&new_label)) {
+                    push_label(thread_id, &new_label);
+                } else {
+                    label_pool.release_label(&new_label);
+                }
+            }
+        }
+
+        // Same as update_non_dominated_labels, under the lock of the node of the label.
+        bool insert_if_non_dominated(Label<ResourceType>* label_ptr) {
+            auto node_pos = label_ptr->get_end_node()->pos();
+            std::lock_guard<std::mutex> lock(node_mutexes_[node_pos]);
+
+            auto& non_dominated_labels = this->non_dominated_labels_by_node_pos_.at(node_pos);
+            if (this->is_dominated(non_dominated_labels, *label_ptr)) {
+                return false;
+            }
+            this->remove_dominated_labels(&non_dominated_labels, *label_ptr);
+
+            non_dominated_labels.insert(label_ptr);
+            return true;
+        }
+
+        void push_label(size_t thread_id, Label<ResourceType>* label_ptr) {
+            ++num_unprocessed_labels_;
+            auto& work_queue = *work_queues_[thread_id];
+            std::lock_guard<std::mutex> lock(work_queue.mutex);
+            work_queue.labels.push_back(label_ptr);
+        }
+
+        bool pop_label(size_t thread_id, Label<ResourceType>** label_ptr) {
+            auto& work_queue = *work_queues_[thread_id];
+            std::lock_guard<std::mutex> lock(work_queue.mutex);
+            if (work_queue.labels.empty()) {
+                return false;
+            }
+            *label_ptr = work_queue.labels.front();
+            work_queue.labels.pop_front();
+            return true;
+        }
+
+        bool steal_label(size_t thread_id, Label<ResourceType>** label_ptr) {
+            for (size_t i = 1; i < num_threads_; ++i) {
+                auto& work_queue = *work_queues_[(thread_id + i) % num_threads_];
+                std::lock_guard<std::mutex> lock(work_queue.mutex);
+                if (!work_queue.labels.empty()) {
+                    *label_ptr = work_queue.labels.back();
+                    work_queue.labels.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const size_t num_threads_;
+
+        std::vector<std::unique_ptr<LabelPool<ResourceType>>> label_pools_;
+        std::vector<std::unique_ptr<WorkQueue>> work_queues_;
+        std::unique_ptr<std::mutex[]> node_mutexes_;  // NOLINT(modernize-avoid-c-arrays)
+
+        std::mutex sink_labels_mutex_;
+        std::vector<const Label<ResourceType>*> sink_labels_;
+
+        std::atomic<size_t> num_unprocessed_labels_{0};
+        std::atomic<size_t> num_iterations_{0};
+        std::atomic<bool> stop_{false};
+        size_t next_queue_ = 0;
+};
+}  // namespace rcspp
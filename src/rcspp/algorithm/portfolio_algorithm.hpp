@@ -0,0 +1,208 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <list>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <thread>  // NOLINT
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "rcspp/algorithm/algorithm.hpp"
+#include "rcspp/algorithm/shared_search_state.hpp"
+
+namespace rcspp {
+
+/**
+ * @brief PortfolioAlgorithm: runs several algorithms concurrently on the same graph and keeps the
+ * fastest.
+ *
+ * Each algorithm of the portfolio solves the graph in its own thread (with the completion bounds
+ * and the arc mask of the portfolio). As soon as one of them finishes with an optimal result (see
+ * @ref is_optimal), or once the algorithms have found stop_after_X_solutions distinct solutions
+ * together, the other algorithms are stopped and return the solutions found so far. The portfolio
+ * returns the solutions of all the algorithms.
+ *
+ * With share_best_cost, the cost of the best solution found by any algorithm is used as upper
+ * bound by all the others: they only look for cheaper solutions, which speeds up the search for
+ * the best solution but may return fewer solutions. The result is optimal (see @ref is_optimal)
+ * if one of the algorithms finished with an optimal result.
+ *
+ * Usage: construct with a resource factory, algorithm parameters (only stop_after_X_solutions and
+ * time_limit are used) and the algorithms to run (e.g., SimpleDominanceAlgorithm,
+ * PullingDominanceAlgorithm and DiversificationSearch, which are each the fastest on different
+ * instances). To cancel the portfolio, give the same cancellation token to all its algorithms.
+ */
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class PortfolioAlgorithm : public Algorithm<ResourceType> {
+    public:
+        PortfolioAlgorithm(ResourceFactory<ResourceType>* resource_factory, AlgorithmParams params,
+                           std::vector<std::unique_ptr<Algorithm<ResourceType>>> algorithms,
+                           bool share_best_cost = true)
+            : Algorithm<ResourceType>(resource_factory, std::move(params)),
+              algorithms_(std::move(algorithms)),
+              search_state_(this->params_.stop_after_X_solutions, share_best_cost) {
+            if (algorithms_.empty()) {
+                LOG_FATAL("PortfolioAlgorithm: no algorithm to run.\n");
+                throw std::runtime_error("PortfolioAlgorithm: no algorithm to run.");
+            }
+            for (auto& algorithm : algorithms_) {
+                algorithm->set_shared_state(&search_state_);
+            }
+        }
+
+        ~PortfolioAlgorithm() override = default;
+
+        [[nodiscard]] bool is_optimal() const override {
+            return std::ranges::any_of(algorithms_, [](const auto& algorithm) {
+                return algorithm->is_optimal();
+            });
+        }
+
+        // The algorithms stream their solutions concurrently: the callback is called under a lock,
+        // once by distinct solution, and stops all the algorithms once it returns false.
+        void set_solution_callback(SolutionCallback callback) override {
+            solution_callback_ = std::move(callback);
+            for (auto& algorithm : algorithms_) {
+                if (solution_callback_) {
+                    algorithm->set_solution_callback(
+                        [this](const Solution& solution) { return stream_solution(solution); });
+                } else {
+                    algorithm->set_solution_callback({});
+                }
+            }
+        }
+
+        std::vector<Solution> solve(const Graph<ResourceType>* graph,
+                                    double cost_upper_bound) override {
+            Timer timer;
+
+            this->graph_ = graph;
+            this->cost_upper_bound_ = cost_upper_bound;
+            this->solutions_.clear();
+            this->start_deadline();
+            search_state_.reset();
+            streamed_solution_hashes_.clear();
+            callback_stopped_ = false;
+            size_t winner = algorithms_.size();
+
+            std::vector<std::vector<Solution>> solutions_by_algorithm(algorithms_.size());
+            std::mutex mutex;
+            std::exception_ptr exception;
+            auto run_algorithm = [&](size_t a) {
+                try {
+                    solutions_by_algorithm[a] = algorithms_[a]->solve(graph, cost_upper_bound);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                    search_state_.request_stop();
+                    return;
+                }
+
+                // the first algorithm to finish with an optimal result stops the others (a
+                // heuristic finishing first does not prove anything)
+                if (!algorithms_[a]->is_optimal()) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                if (winner == algorithms_.size()) {
+                    winner = a;
+                }
+                search_state_.request_stop();
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(algorithms_.size());
+            for (size_t a = 0; a < algorithms_.size(); ++a) {
+                algorithms_[a]->set_completion_bounds(this->get_completion_bounds());
+                algorithms_[a]->set_arc_mask(this->get_arc_mask());
+                algorithms_[a]->set_deadline(this->deadline_);
+                threads.emplace_back(run_algorithm, a);
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+
+            // solutions of all the algorithms (the same solution may be found by several of them)
+            for (auto& solutions : solutions_by_algorithm) {
+                for (auto& solution : solutions) {
+                    if (solution.cost < cost_upper_bound) {
+                        this->solutions_.insert(std::move(solution));
+                    }
+                }
+            }
+
+            std::vector<Solution> solutions;
+            solutions.reserve(this->solutions_.size());
+            for (auto&& solution : this->solutions_) {
+                solutions.push_back(std::move(solution));
+            }
+            this->solutions_.clear();
+
+            std::ranges::sort(solutions,
+                              [](const Solution& a, const Solution& b) { return a.cost < b.cost; });
+            if (solutions.size() > this->params_.stop_after_X_solutions) {
+                solutions.resize(this->params_.stop_after_X_solutions);
+            }
+
+            LOG_DEBUG("PortfolioAlgorithm: ",
+                      solutions.size(),
+                      " solutions, first optimal algorithm: ",
+                      winner,
+                      ", total time=",
+                      timer.elapsed_seconds(),
+                      " sec.\n");
+
+            return solutions;
+        }
+
+    protected:
+        void initialize_labels() override {}
+
+        [[nodiscard]] size_t number_of_labels() const override { return 0; }
+
+        void main_loop() override {}
+
+        [[nodiscard]] std::list<Label<ResourceType>*> get_labels_at_sinks() const override {
+            return {};
+        }
+
+        std::list<size_t> get_path_arc_ids(const Label<ResourceType>& /*label*/) override {
+            throw std::runtime_error("No get_path_arc_ids");
+        }
+
+    private:
+        bool stream_solution(const Solution& solution) {
+            std::lock_guard<std::mutex> lock(callback_mutex_);
+            if (callback_stopped_ ||
+                !streamed_solution_hashes_.insert(solution.get_hash()).second) {
+                return !callback_stopped_;
+            }
+            if (!solution_callback_(solution)) {
+                callback_stopped_ = true;
+                search_state_.request_stop();
+            }
+            return !callback_stopped_;
+        }
+
+        std::vector<std::unique_ptr<Algorithm<ResourceType>>> algorithms_;
+        SharedSearchState search_state_;
+
+        SolutionCallback solution_callback_;
+        std::mutex callback_mutex_;
+        std::unordered_set<std::uint64_t> streamed_solution_hashes_;
+        bool callback_stopped_{false};
+};
+}  // namespace rcspp
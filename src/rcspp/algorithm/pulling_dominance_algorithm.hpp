@@ -26,12 +26,17 @@ class PullingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
     protected:
         void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
             Algorithm<ResourceType>::initialize(graph, cost_upper_bound);
+            this->clear_unprocessed_labels();
             this->initialize_unprocessed_labels(graph->get_number_of_nodes());
         }
 
         void main_loop() override {
             size_t i = 0;
             while (number_of_labels() > 0 && i < this->params_.max_iterations) {
+                if (this->must_stop()) {
+                    LOG_DEBUG("Stopping on request.\n");
+                    return;
+                }
                 ++i;
 
                 // save unprocessed labels for the current node
@@ -45,7 +50,7 @@ class PullingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
                 // filter labels at current node
                 for (auto it = this->current_unprocessed_labels_.begin();
                      it != this->current_unprocessed_labels_.end();) {
-                    auto& label = *it->first;
+                    auto& label = **it;
 
                     // label dominated -> continue to next one
                     if (label.dominated) {
@@ -53,7 +58,7 @@ class PullingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
                         it = erase_unprocessed_label(it);  // erase label
                     } else if (std::isinf(label.get_cost())) {
                         // label cost too high -> continue to next one
-                        this->remove_label(it->second);
+                        this->remove_label(&label);
                         this->label_pool_.release_label(&label);
                         it = erase_unprocessed_label(it);  // erase label
                     } else {
@@ -61,7 +66,8 @@ class PullingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
                         // check if sink and update best solution
                         if (label.get_end_node()->sink &&
                             label.get_cost() < this->cost_upper_bound_ &&
-                            this->params_.return_dominated_solutions) {
+                            (this->params_.return_dominated_solutions ||
+                             this->is_streamed(label))) {
                             this->extract_solution(label);
                             if (this->solutions_.size() >= this->params_.stop_after_X_solutions) {
                                 LOG_DEBUG("Stopping after ",
@@ -76,8 +82,8 @@ class PullingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
             }
         }
 
-        LabelIteratorPair<ResourceType> next_label_iterator() override {
-            throw std::runtime_error("next_label_iterator() not implemented");
+        Label<ResourceType>* next_label() override {
+            throw std::runtime_error("next_label() not implemented");
         }
 
         void extend(Label<ResourceType>* label_ptr) override {
@@ -121,11 +127,14 @@ class PullingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
             const auto& current_node =
                 this->graph_->get_sorted_nodes().at(this->current_unprocessed_node_pos_);
             for (auto arc_ptr : current_node->in_arcs) {
+                if (this->is_arc_removed(*arc_ptr)) {
+                    continue;
+                }
                 // pull all the unprocessed labels from the origin node
                 const auto& unprocessed_labels =
                     this->unprocessed_labels_by_node_pos_.at(arc_ptr->origin->pos());
-                for (const auto& label_iterator_pair : unprocessed_labels) {
-                    this->extend_label(label_iterator_pair.first, arc_ptr);
+                for (auto* label_ptr : unprocessed_labels) {
+                    this->extend_label(label_ptr, arc_ptr);
                 }
             }
 
@@ -141,13 +150,12 @@ class PullingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
             return this->num_unprocessed_labels_;
         }
 
-        void add_new_unprocessed_label(
-            const LabelIteratorPair<ResourceType>& label_iterator_pair) override {
-            this->add_new_label(label_iterator_pair);
+        void add_new_unprocessed_label(Label<ResourceType>* label_ptr) override {
+            this->add_new_label(label_ptr);
         }
 
-        std::list<LabelIteratorPair<ResourceType>>::iterator erase_unprocessed_label(
-            const std::list<LabelIteratorPair<ResourceType>>::iterator& label_iterator) {
+        std::list<Label<ResourceType>*>::iterator erase_unprocessed_label(
+            const std::list<Label<ResourceType>*>::iterator& label_iterator) {
             --this->num_unprocessed_labels_;
             return this->current_unprocessed_labels_.erase(label_iterator);
         }
@@ -24,10 +24,11 @@ class PushingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
     protected:
         void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
             Algorithm<ResourceType>::initialize(graph, cost_upper_bound);
+            this->clear_unprocessed_labels();
             this->initialize_unprocessed_labels(graph->get_number_of_nodes());
         }
 
-        LabelIteratorPair<ResourceType> next_label_iterator() override {
+        Label<ResourceType>* next_label() override {
             // if no more labels for the current node, move to the next node with labels
             while (this->current_unprocessed_labels_.empty()) {
                 // move to the next node
@@ -46,21 +47,20 @@ class PushingDominanceAlgorithm : public DominanceAlgorithm<ResourceType>,
             }
 
             // get the next label
-            auto label_iterator_pair = this->current_unprocessed_labels_.front();
+            auto* label_ptr = this->current_unprocessed_labels_.front();
 
             this->current_unprocessed_labels_.pop_front();
             --this->num_unprocessed_labels_;
 
-            return label_iterator_pair;
+            return label_ptr;
         }
 
         [[nodiscard]] size_t number_of_labels() const override {
             return this->num_unprocessed_labels_;
         }
 
-        void add_new_unprocessed_label(
-            const LabelIteratorPair<ResourceType>& label_iterator_pair) override {
-            this->add_new_label(label_iterator_pair);
+        void add_new_unprocessed_label(Label<ResourceType>* label_ptr) override {
+            this->add_new_label(label_ptr);
         }
 
         void prepareNextPhase() override { this->restore_truncated_unprocessed_labels(); }
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>  // NOLINT
+#include <unordered_set>
+
+#include "rcspp/algorithm/solution.hpp"
+
+namespace rcspp {
+
+/**
+ * @brief State shared by several algorithms solving the same problem concurrently (see
+ * PortfolioAlgorithm).
+ *
+ * The algorithms report the solutions they find. The state counts the distinct solutions (same
+ * equality as Solution, by hash) and requests all the algorithms to stop once enough solutions
+ * have been found. If the best cost is shared, the algorithms use the cost of the best solution
+ * found by any of them as upper bound: they only look for cheaper solutions.
+ */
+class SharedSearchState {
+    public:
+        explicit SharedSearchState(size_t max_num_solutions, bool share_best_cost = true)
+            : max_num_solutions_(max_num_solutions),
+              share_best_cost_(share_best_cost) {}
+
+        // Prepare a new search (not thread-safe: before starting the algorithms).
+        void reset() {
+            best_cost_ = std::numeric_limits<double>::infinity();
+            stop_ = false;
+            solution_hashes_.clear();
+        }
+
+        void add_solution(const Solution& solution) {
+            if (share_best_cost_) {
+                // atomic min
+                double best_cost = best_cost_.load(std::memory_order_relaxed);
+                while (solution.cost < best_cost &&
+                       !best_cost_.compare_exchange_weak(best_cost,
+                                                         solution.cost,
+                                                         std::memory_order_relaxed)) {
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            solution_hashes_.insert(solution.get_hash());
+            if (solution_hashes_.size() >= max_num_solutions_) {
+                stop_ = true;
+            }
+        }
+
+        void request_stop() { stop_ = true; }
+
+        [[nodiscard]] bool stop_requested() const { return stop_.load(std::memory_order_relaxed); }
+
+        // Upper bound on the cost of the solutions still to be found (infinity if the best cost is
+        // not shared).
+        [[nodiscard]] double get_upper_bound() const {
+            return best_cost_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] size_t get_number_of_solutions() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return solution_hashes_.size();
+        }
+
+    private:
+        const size_t max_num_solutions_;
+        const bool share_best_cost_;
+
+        std::atomic<double> best_cost_{std::numeric_limits<double>::infinity()};
+        std::atomic<bool> stop_{false};
+
+        mutable std::mutex mutex_;
+        std::unordered_set<std::uint64_t> solution_hashes_;
+};
+}  // namespace rcspp
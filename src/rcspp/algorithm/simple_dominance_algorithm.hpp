@@ -23,40 +23,43 @@ class SimpleDominanceAlgorithm : public DominanceAlgorithm<ResourceType> {
     private:
         void initialize(const Graph<ResourceType>* graph, double cost_upper_bound) override {
             Algorithm<ResourceType>::initialize(graph, cost_upper_bound);
-            number_of_extended_labels_per_node_.resize(graph->get_number_of_nodes());
+            // forget the labels left by the previous solve (e.g., if it was stopped early): they
+            // are released with the label pool
+            unprocessed_labels_.clear();
+            unprocessed_truncated_labels_.clear();
+            number_of_extended_labels_per_node_.assign(graph->get_number_of_nodes(), 0);
         }
-        LabelIteratorPair<ResourceType> next_label_iterator() override {
-            LabelIteratorPair<ResourceType> label_iterator_pair;
+        Label<ResourceType>* next_label() override {
             while (!unprocessed_labels_.empty()) {
-                label_iterator_pair = unprocessed_labels_.front();
+                auto* label_ptr = unprocessed_labels_.front();
                 unprocessed_labels_.pop_front();
 
                 // if dominated, release the label
-                if (label_iterator_pair.first->dominated) {
-                    this->label_pool_.release_label(label_iterator_pair.first);
+                if (label_ptr->dominated) {
+                    this->label_pool_.release_label(label_ptr);
                 } else {
                     // truncate/limit the number of labels extended per node
                     size_t& num_extended_labels_for_node = number_of_extended_labels_per_node_.at(
-                        label_iterator_pair.first->get_end_node()->pos());
+                        label_ptr->get_end_node()->pos());
                     if (num_extended_labels_for_node < this->params_.num_labels_to_extend_by_node) {
                         ++num_extended_labels_for_node;
-                        break;  // found a label to process
+                        return label_ptr;  // found a label to process
                     }
                     // otherwise, store truncated label for next phase
-                    unprocessed_truncated_labels_.push_back(label_iterator_pair);
+                    unprocessed_truncated_labels_.push_back(label_ptr);
                 }
             }
 
-            return label_iterator_pair;
+            // a released or truncated label must not be processed
+            return nullptr;
         }
 
         [[nodiscard]] size_t number_of_labels() const override {
             return unprocessed_labels_.size();
         }
 
-        void add_new_unprocessed_label(
-            const LabelIteratorPair<ResourceType>& label_iterator_pair) override {
-            unprocessed_labels_.push_back(label_iterator_pair);
+        void add_new_unprocessed_label(Label<ResourceType>* label_ptr) override {
+            unprocessed_labels_.push_back(label_ptr);
         }
 
         void prepareNextPhase() override {
@@ -66,8 +69,8 @@ class SimpleDominanceAlgorithm : public DominanceAlgorithm<ResourceType> {
             unprocessed_labels_.splice(unprocessed_labels_.end(), unprocessed_truncated_labels_);
         }
 
-        std::list<LabelIteratorPair<ResourceType>> unprocessed_labels_;
-        std::list<LabelIteratorPair<ResourceType>> unprocessed_truncated_labels_;
+        std::list<Label<ResourceType>*> unprocessed_labels_;
+        std::list<Label<ResourceType>*> unprocessed_truncated_labels_;
         std::vector<size_t> number_of_extended_labels_per_node_;
 };
 }  // namespace rcspp
@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace rcspp {
+
+/**
+ * @brief Arcs removed from a graph for a single solve, indexed by arc id.
+ *
+ * The graph itself is not modified: the algorithms skip the removed arcs, so that several solves
+ * with different masks (e.g., different upper bounds) can run concurrently on the same graph.
+ */
+class ArcMask {
+    public:
+        void remove(size_t arc_id) {
+            if (arc_id >= removed_.size()) {
+                removed_.resize(arc_id + 1, false);
+            }
+            if (!removed_[arc_id]) {
+                removed_[arc_id] = true;
+                ++num_removed_arcs_;
+            }
+        }
+
+        [[nodiscard]] bool is_removed(size_t arc_id) const {
+            return arc_id < removed_.size() && removed_[arc_id];
+        }
+
+        [[nodiscard]] size_t get_number_of_removed_arcs() const { return num_removed_arcs_; }
+
+    private:
+        std::vector<bool> removed_;
+        size_t num_removed_arcs_ = 0;
+};
+}  // namespace rcspp
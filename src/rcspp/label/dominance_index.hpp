@@ -0,0 +1,244 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "rcspp/resource/concrete/numerical_resource.hpp"
+#include "rcspp/resource/functions/dominance/dominance_signature.hpp"
+
+namespace rcspp {
+
+/**
+ * @brief k-d tree answering the dominance queries on numerical points (e.g., the cost and the keys
+ * of the dominance signatures, see LabelBucket).
+ *
+ * A point p is lower or equal to a point q if value_leq(p[d], q[d]) on each dimension d. Each node
+ * stores the bounding box of its subtree, so that the queries skip the subtrees that cannot contain
+ * a lower (resp. greater) or equal point. The points are inserted in the leaves (an equal
+ * coordinate goes to the right subtree) and erased by marking their nodes. The tree must be rebuilt
+ * (balanced) once needs_rebuild() is true, i.e., once half of its nodes are erased or once it has
+ * doubled since the last build.
+ */
+template <typename Value>
+class DominanceIndex {
+    public:
+        static constexpr size_t MAX_DIMENSIONS = 1 + DominanceSignature::MAX_KEYS;
+        using Point = std::array<double, MAX_DIMENSIONS>;
+
+        // Rebuild the tree (balanced) with the given points and values.
+        void build(std::vector<std::pair<Point, Value>> points, size_t num_dimensions) {
+            clear();
+            num_dimensions_ = num_dimensions;
+            nodes_.reserve(points.size());
+            root_ = build(&points, 0, points.size(), 0);
+            num_built_nodes_ = nodes_.size();
+        }
+
+        void insert(const Point& point, Value value) {
+            const auto new_index = static_cast<int32_t>(nodes_.size());
+            if (root_ < 0) {
+                nodes_.push_back(make_node(point, std::move(value), 0));
+                root_ = new_index;
+                return;
+            }
+            int32_t index = root_;
+            while (true) {
+                auto& node = nodes_[index];
+                expand_box(&node, point);
+                int32_t& child = point[node.split_dimension] < node.point[node.split_dimension]
+                                     ? node.left
+                                     : node.right;
+                if (child < 0) {
+                    const auto split_dimension =
+                        static_cast<uint8_t>((node.split_dimension + 1) % num_dimensions_);
+                    child = new_index;
+                    // node and child are invalidated by the push_back
+                    nodes_.push_back(make_node(point, std::move(value), split_dimension));
+                    return;
+                }
+                index = child;
+            }
+        }
+
+        // Erase the (non erased) node with the given point and value. Return false if not found.
+        bool erase(const Point& point, const Value& value) {
+            int32_t index = root_;
+            while (index >= 0) {
+                auto& node = nodes_[index];
+                if (!node.erased && node.value == value) {
+                    node.erased = true;
+                    ++num_erased_nodes_;
+                    return true;
+                }
+                index = point[node.split_dimension] < node.point[node.split_dimension]
+                            ? node.left
+                            : node.right;
+            }
+            return false;
+        }
+
+        // Whether is_dominating(value) for a value whose point is lower or equal to the point.
+        template <typename Predicate>
+        [[nodiscard]] bool any_leq(const Point& point, Predicate&& is_dominating) const {
+            stack_.clear();
+            if (root_ >= 0) {
+                stack_.push_back(root_);
+            }
+            while (!stack_.empty()) {
+                const auto& node = nodes_[stack_.back()];
+                stack_.pop_back();
+                if (!leq(node.min, point)) {
+                    continue;
+                }
+                if (!node.erased && leq(node.point, point) && is_dominating(node.value)) {
+                    return true;
+                }
+                // the left subtree (lower coordinates) is explored first
+                if (node.right >= 0) {
+                    stack_.push_back(node.right);
+                }
+                if (node.left >= 0) {
+                    stack_.push_back(node.left);
+                }
+            }
+            return false;
+        }
+
+        // Erase the values whose point is greater or equal to the point and for which
+        // is_dominated(value) is true (called once for each of these values).
+        template <typename Predicate>
+        void erase_geq_if(const Point& point, Predicate&& is_dominated) {
+            stack_.clear();
+            if (root_ >= 0) {
+                stack_.push_back(root_);
+            }
+            while (!stack_.empty()) {
+                auto& node = nodes_[stack_.back()];
+                stack_.pop_back();
+                if (!leq(point, node.max)) {
+                    continue;
+                }
+                if (!node.erased && leq(point, node.point) && is_dominated(node.value)) {
+                    node.erased = true;
+                    ++num_erased_nodes_;
+                }
+                if (node.left >= 0) {
+                    stack_.push_back(node.left);
+                }
+                if (node.right >= 0) {
+                    stack_.push_back(node.right);
+                }
+            }
+        }
+
+        [[nodiscard]] bool needs_rebuild() const {
+            return 2 * num_erased_nodes_ > nodes_.size() ||
+                   nodes_.size() > 2 * std::max<size_t>(num_built_nodes_, MIN_REBUILD_SIZE);
+        }
+
+        void clear() {
+            nodes_.clear();
+            root_ = -1;
+            num_erased_nodes_ = 0;
+            num_built_nodes_ = 0;
+        }
+
+        [[nodiscard]] size_t get_num_dimensions() const { return num_dimensions_; }
+
+        // Memory allocated by the index in bytes (not including the values).
+        [[nodiscard]] size_t get_memory_usage() const {
+            return nodes_.capacity() * sizeof(Node) + stack_.capacity() * sizeof(int32_t);
+        }
+
+    private:
+        // Minimum number of nodes built before rebuilding a tree because of its insertions.
+        static constexpr size_t MIN_REBUILD_SIZE = 16;
+
+        struct Node {
+                Point point;
+                Point min;  // bounding box of the subtree
+                Point max;
+                Value value;
+                int32_t left = -1;
+                int32_t right = -1;
+                uint8_t split_dimension = 0;
+                bool erased = false;
+        };
+
+        [[nodiscard]] static Node make_node(const Point& point, Value value,
+                                            uint8_t split_dimension) {
+            Node node{point, point, point, std::move(value)};
+            node.split_dimension = split_dimension;
+            return node;
+        }
+
+        void expand_box(Node* node, const Point& point) const {
+            for (size_t d = 0; d < num_dimensions_; ++d) {
+                node->min[d] = std::min(node->min[d], point[d]);
+                node->max[d] = std::max(node->max[d], point[d]);
+            }
+        }
+
+        [[nodiscard]] bool leq(const Point& lhs, const Point& rhs) const {
+            for (size_t d = 0; d < num_dimensions_; ++d) {
+                if (!value_leq(lhs[d], rhs[d])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Build the subtree of the points [begin, end) (median split, the points with the same
+        // coordinate as the median go to the right subtree).
+        int32_t build(std::vector<std::pair<Point, Value>>* points, size_t begin, size_t end,
+                      uint8_t split_dimension) {
+            if (begin == end) {
+                return -1;
+            }
+            auto first = points->begin() + static_cast<std::ptrdiff_t>(begin);
+            auto last = points->begin() + static_cast<std::ptrdiff_t>(end);
+            const auto by_coordinate = [split_dimension](const auto& lhs, const auto& rhs) {
+                return lhs.first[split_dimension] < rhs.first[split_dimension];
+            };
+            std::sort(first, last, by_coordinate);
+            auto median = first + static_cast<std::ptrdiff_t>((end - begin) / 2);
+            median = std::lower_bound(first, median, *median, by_coordinate);
+            const size_t median_index = begin + static_cast<size_t>(median - first);
+
+            const auto index = static_cast<int32_t>(nodes_.size());
+            nodes_.push_back(make_node(median->first, std::move(median->second), split_dimension));
+            const auto next_dimension =
+                static_cast<uint8_t>((split_dimension + 1) % num_dimensions_);
+            const int32_t left = build(points, begin, median_index, next_dimension);
+            const int32_t right = build(points, median_index + 1, end, next_dimension);
+            auto& node = nodes_[index];
+            node.left = left;
+            node.right = right;
+            for (const int32_t child : {left, right}) {
+                if (child >= 0) {
+                    for (size_t d = 0; d < num_dimensions_; ++d) {
+                        node.min[d] = std::min(node.min[d], nodes_[child].min[d]);
+                        node.max[d] = std::max(node.max[d], nodes_[child].max[d]);
+                    }
+                }
+            }
+            return index;
+        }
+
+        std::vector<Node> nodes_;
+        int32_t root_ = -1;
+        size_t num_dimensions_ = 1;
+        size_t num_erased_nodes_ = 0;
+        size_t num_built_nodes_ = 0;
+
+        // DFS stack of the queries (kept to avoid an allocation by query).
+        mutable std::vector<int32_t> stack_;
+};
+}  // namespace rcspp
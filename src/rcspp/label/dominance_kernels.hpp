@@ -0,0 +1,188 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>  // NOLINT
+#include <limits>
+
+#include "rcspp/resource/concrete/bitset_kernels.hpp"
+#include "rcspp/resource/concrete/numerical_resource.hpp"
+
+namespace rcspp::dominance_kernels {
+
+/**
+ * @brief Batched dominance tests of one point against the points stored by columns (one array of
+ * coordinates by dimension, see LabelBucket).
+ *
+ * Each kernel compares the point with the n <= 64 points [first, first + n) of the columns and
+ * returns the mask whose bit j is set iff the point first + j is lower (leq_mask) or greater
+ * (geq_mask) or equal to the point on all the dimensions, with the tolerance of value_leq. A NaN
+ * coordinate is never lower nor greater or equal (e.g., for an erased point). The AVX2 and AVX-512
+ * kernels compare 4 and 8 points by instruction, and are selected at runtime as the bitset kernels
+ * (see bitset_kernels::get_simd_level).
+ */
+inline constexpr size_t MAX_BATCH_SIZE = 64;
+
+inline constexpr double EPSILON = std::numeric_limits<double>::epsilon();
+
+// Scalar kernels ---------------------------------------------------------------------------------
+
+inline uint64_t leq_mask_scalar(const double* const* columns, size_t num_dimensions, size_t first,
+                                size_t n, const double* point) {
+    uint64_t mask = 0;
+    for (size_t j = 0; j < n; ++j) {
+        bool leq = true;
+        for (size_t d = 0; d < num_dimensions && leq; ++d) {
+            leq = value_leq(columns[d][first + j], point[d]);
+        }
+        mask |= static_cast<uint64_t>(leq) << j;
+    }
+    return mask;
+}
+
+inline uint64_t geq_mask_scalar(const double* const* columns, size_t num_dimensions, size_t first,
+                                size_t n, const double* point) {
+    uint64_t mask = 0;
+    for (size_t j = 0; j < n; ++j) {
+        bool geq = true;
+        for (size_t d = 0; d < num_dimensions && geq; ++d) {
+            geq = value_leq(point[d], columns[d][first + j]);
+        }
+        mask |= static_cast<uint64_t>(geq) << j;
+    }
+    return mask;
+}
+
+#ifdef RCSPP_BITSET_SIMD
+
+// AVX2 kernels (4 points by iteration) -----------------------------------------------------------
+
+__attribute__((target("avx2"))) inline uint64_t leq_mask_avx2(const double* const* columns,
+                                                               size_t num_dimensions, size_t first,
+                                                               size_t n, const double* point) {
+    uint64_t mask = 0;
+    size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        int block_mask = 0xF;
+        for (size_t d = 0; d < num_dimensions && block_mask != 0; ++d) {
+            // value_leq(x, point[d]) is x <= point[d] + EPSILON
+            const __m256d bound = _mm256_set1_pd(point[d] + EPSILON);
+            const __m256d values = _mm256_loadu_pd(columns[d] + first + j);
+            block_mask &= _mm256_movemask_pd(_mm256_cmp_pd(values, bound, _CMP_LE_OQ));
+        }
+        mask |= static_cast<uint64_t>(block_mask) << j;
+    }
+    if (j < n) {
+        mask |= leq_mask_scalar(columns, num_dimensions, first + j, n - j, point) << j;
+    }
+    return mask;
+}
+
+__attribute__((target("avx2"))) inline uint64_t geq_mask_avx2(const double* const* columns,
+                                                               size_t num_dimensions, size_t first,
+                                                               size_t n, const double* point) {
+    const __m256d epsilon = _mm256_set1_pd(EPSILON);
+    uint64_t mask = 0;
+    size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        int block_mask = 0xF;
+        for (size_t d = 0; d < num_dimensions && block_mask != 0; ++d) {
+            // value_leq(point[d], x) is point[d] <= x + EPSILON
+            const __m256d bound =
+                _mm256_add_pd(_mm256_loadu_pd(columns[d] + first + j), epsilon);
+            block_mask &=
+                _mm256_movemask_pd(_mm256_cmp_pd(_mm256_set1_pd(point[d]), bound, _CMP_LE_OQ));
+        }
+        mask |= static_cast<uint64_t>(block_mask) << j;
+    }
+    if (j < n) {
+        mask |= geq_mask_scalar(columns, num_dimensions, first + j, n - j, point) << j;
+    }
+    return mask;
+}
+
+// AVX-512 kernels (8 points by iteration) --------------------------------------------------------
+
+__attribute__((target("avx512f"))) inline uint64_t leq_mask_avx512(const double* const* columns,
+                                                                    size_t num_dimensions,
+                                                                    size_t first, size_t n,
+                                                                    const double* point) {
+    uint64_t mask = 0;
+    size_t j = 0;
+    for (; j + 8 <= n; j += 8) {
+        __mmask8 block_mask = 0xFF;
+        for (size_t d = 0; d < num_dimensions && block_mask != 0; ++d) {
+            const __m512d bound = _mm512_set1_pd(point[d] + EPSILON);
+            const __m512d values = _mm512_loadu_pd(columns[d] + first + j);
+            block_mask = _mm512_mask_cmp_pd_mask(block_mask, values, bound, _CMP_LE_OQ);
+        }
+        mask |= static_cast<uint64_t>(block_mask) << j;
+    }
+    if (j < n) {
+        mask |= leq_mask_scalar(columns, num_dimensions, first + j, n - j, point) << j;
+    }
+    return mask;
+}
+
+__attribute__((target("avx512f"))) inline uint64_t geq_mask_avx512(const double* const* columns,
+                                                                    size_t num_dimensions,
+                                                                    size_t first, size_t n,
+                                                                    const double* point) {
+    const __m512d epsilon = _mm512_set1_pd(EPSILON);
+    uint64_t mask = 0;
+    size_t j = 0;
+    for (; j + 8 <= n; j += 8) {
+        __mmask8 block_mask = 0xFF;
+        for (size_t d = 0; d < num_dimensions && block_mask != 0; ++d) {
+            const __m512d bound =
+                _mm512_add_pd(_mm512_loadu_pd(columns[d] + first + j), epsilon);
+            block_mask = _mm512_mask_cmp_pd_mask(
+                block_mask, _mm512_set1_pd(point[d]), bound, _CMP_LE_OQ);
+        }
+        mask |= static_cast<uint64_t>(block_mask) << j;
+    }
+    if (j < n) {
+        mask |= geq_mask_scalar(columns, num_dimensions, first + j, n - j, point) << j;
+    }
+    return mask;
+}
+
+#endif  // RCSPP_BITSET_SIMD
+
+// Dispatch ---------------------------------------------------------------------------------------
+
+// Mask of the points [first, first + n) lower or equal to the point (n <= MAX_BATCH_SIZE).
+inline uint64_t leq_mask(const double* const* columns, size_t num_dimensions, size_t first,
+                         size_t n, const double* point) {
+#ifdef RCSPP_BITSET_SIMD
+    switch (bitset_kernels::get_simd_level()) {
+        case bitset_kernels::SimdLevel::Avx512:
+            return leq_mask_avx512(columns, num_dimensions, first, n, point);
+        case bitset_kernels::SimdLevel::Avx2:
+            return leq_mask_avx2(columns, num_dimensions, first, n, point);
+        case bitset_kernels::SimdLevel::Scalar:
+            break;
+    }
+#endif
+    return leq_mask_scalar(columns, num_dimensions, first, n, point);
+}
+
+// Mask of the points [first, first + n) greater or equal to the point (n <= MAX_BATCH_SIZE).
+inline uint64_t geq_mask(const double* const* columns, size_t num_dimensions, size_t first,
+                         size_t n, const double* point) {
+#ifdef RCSPP_BITSET_SIMD
+    switch (bitset_kernels::get_simd_level()) {
+        case bitset_kernels::SimdLevel::Avx512:
+            return geq_mask_avx512(columns, num_dimensions, first, n, point);
+        case bitset_kernels::SimdLevel::Avx2:
+            return geq_mask_avx2(columns, num_dimensions, first, n, point);
+        case bitset_kernels::SimdLevel::Scalar:
+            break;
+    }
+#endif
+    return geq_mask_scalar(columns, num_dimensions, first, n, point);
+}
+
+}  // namespace rcspp::dominance_kernels
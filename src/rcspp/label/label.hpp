@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <concepts>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <utility>
@@ -11,22 +13,28 @@
 #include "rcspp/graph/arc.hpp"
 #include "rcspp/graph/node.hpp"
 #include "rcspp/resource/base/resource.hpp"
+#include "rcspp/resource/functions/dominance/dominance_signature.hpp"
 
 namespace rcspp {
 
 template <typename ResourceType>
 class LabelFactory;
 
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class LabelPool;
+
 template <typename ResourceType>
     requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
 class Label {
         friend class LabelFactory<ResourceType>;
+        friend class LabelPool<ResourceType>;
 
     public:
         // Label ID
         size_t id;
 
-        Label(size_t label_id, std::unique_ptr<Resource<ResourceType>> resource)
+        Label(size_t label_id, Resource<ResourceType> resource)
             : id(label_id),
               dominated(false),
               resource_(std::move(resource)),
@@ -34,9 +42,8 @@ class Label {
               in_arc_(nullptr),
               out_arc_(nullptr) {}
 
-        Label(size_t label_id, std::unique_ptr<Resource<ResourceType>> resource,
-              const Node<ResourceType>* end_node, const Arc<ResourceType>* in_arc,
-              const Arc<ResourceType>* out_arc)
+        Label(size_t label_id, Resource<ResourceType> resource, const Node<ResourceType>* end_node,
+              const Arc<ResourceType>* in_arc, const Arc<ResourceType>* out_arc)
             : id(label_id),
               dominated(false),
               resource_(std::move(resource)),
@@ -46,34 +53,61 @@ class Label {
 
         // Check dominance
         [[nodiscard]] bool operator<=(const Label& rhs_label) const {
-            return *resource_ <= *rhs_label.resource_;
+            return resource_ <= rhs_label.resource_;
         }
 
-        // Label extension
+        // Label extension (extended_label must be a new label of the pool: it keeps a reference to
+        // this label as its parent)
         void extend(const Arc<ResourceType>& arc, Label* extended_label) const {
-            arc.extender->extend(*resource_, extended_label->resource_.get());
+            arc.extender->extend(resource_, &extended_label->resource_);
             extended_label->end_node_ = arc.destination;
             extended_label->in_arc_ = &arc;
             extended_label->out_arc_ = nullptr;
+            extended_label->parent_ = this;
+            extended_label->update_dominance_signature();
+            num_references_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Extend again the parent of the label along the same arc, e.g., after a change of the
+        // resources of the arc (the parent must be up to date)
+        void update_from_parent() {
+            if (parent_ != nullptr) {
+                in_arc_->extender->extend(parent_->resource_, &resource_);
+                update_dominance_signature();
+            }
+        }
+
+        // Signature of the resource, to reject most non-dominance cases before the full check
+        // (invalid for the source labels, which are then always fully checked).
+        [[nodiscard]] const DominanceSignature& get_dominance_signature() const {
+            return dominance_signature_;
         }
 
         // Return label cost
-        [[nodiscard]] double get_cost() const { return resource_->get_cost(); }
+        [[nodiscard]] double get_cost() const { return resource_.get_cost(); }
 
         // Return true if the label is feasible
-        [[nodiscard]] bool is_feasible() const { return resource_->is_feasible(); }
+        [[nodiscard]] bool is_feasible() const { return resource_.is_feasible(); }
 
-        [[nodiscard]] Resource<ResourceType>& get_resource() const { return *resource_; }
+        [[nodiscard]] Resource<ResourceType>& get_resource() { return resource_; }
+
+        [[nodiscard]] const Resource<ResourceType>& get_resource() const { return resource_; }
 
         [[nodiscard]] const Node<ResourceType>* get_end_node() const { return end_node_; }
 
         [[nodiscard]] const Arc<ResourceType>* get_in_arc() const { return in_arc_; }
 
+        // Label from which this label was extended (nullptr for a source label).
+        [[nodiscard]] const Label* get_parent() const { return parent_; }
+
         bool dominated;
 
     private:
-        // Resource consumed by the label.
-        std::unique_ptr<Resource<ResourceType>> resource_;
+        // Resource consumed by the label (stored inline, see LabelPool).
+        Resource<ResourceType> resource_;
+
+        // Signature of resource_, updated with it on each extension.
+        DominanceSignature dominance_signature_;
 
         // Pointer to the node at the end of the path associated with the current label.
         const Node<ResourceType>* end_node_;
@@ -83,5 +117,17 @@ class Label {
 
         // Pointer to the arc from which this label was backward extended.
         const Arc<ResourceType>* out_arc_;
+
+        // Pointer to the label from which this label was extended.
+        const Label* parent_ = nullptr;
+
+        // Number of references to the label: one until it is released, plus one for each label
+        // extended from it that has not been released. The label is reused by its pool once it
+        // has no references left.
+        mutable std::atomic<uint32_t> num_references_{1};
+
+        void update_dominance_signature() {
+            dominance_signature_ = resource_.get_dominance_signature();
+        }
 };
 }  // namespace rcspp
@@ -0,0 +1,413 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>  // NOLINT
+#include <concepts>
+#include <cstddef>
+#include <cstdint>  // NOLINT
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "rcspp/label/dominance_index.hpp"
+#include "rcspp/label/dominance_kernels.hpp"
+#include "rcspp/label/label.hpp"
+
+namespace rcspp {
+
+// Minimum number of tombstones before compacting a bucket.
+inline constexpr size_t MIN_LABEL_BUCKET_TOMBSTONES = 16;
+
+// Minimum number of labels in a bucket before indexing them (see DominanceIndex).
+inline constexpr size_t MIN_INDEXED_LABELS = 64;
+
+/**
+ * @brief Contiguous container of the non-dominated labels ending at a node.
+ *
+ * The labels are stored in a vector together with their cost and dominance signature, so that the
+ * dominance scans do not need to dereference the labels that cannot dominate (any valid dominance
+ * implies a lower or equal cost and compatible signatures, see DominanceSignature). The entries are
+ * sorted by cost, so that these scans can stop at the first label with a higher cost (or start at
+ * the first one with a lower or equal cost). Removing a label leaves a tombstone, and the vector is
+ * compacted once the tombstones represent at least half of its entries. The iteration skips the
+ * tombstones.
+ *
+ * When the signatures of the labels have numerical keys (e.g., the compositions of numerical
+ * resources with a ValueDominanceFunction), the costs and keys are also stored by columns, and the
+ * dominance queries (see any_dominating_candidate and erase_dominated_candidates_if) compare the
+ * label with batches of labels at once (see dominance_kernels). Once the bucket holds
+ * MIN_INDEXED_LABELS such labels, they are also indexed in a k-d tree, so that the queries only
+ * visit the labels that are lower (resp. greater) or equal on all these dimensions.
+ */
+template <typename ResourceType>
+    requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
+class LabelBucket {
+    public:
+        struct Entry {
+                double cost;
+                DominanceSignature signature;
+                Label<ResourceType>* label;  // nullptr for a tombstone
+
+                // Same label (to find the entry in the index).
+                friend bool operator==(const Entry& lhs, const Entry& rhs) {
+                    return lhs.label == rhs.label;
+                }
+        };
+
+        class Iterator {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Label<ResourceType>*;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Label<ResourceType>* const*;
+                using reference = Label<ResourceType>* const&;
+
+                Iterator() = default;
+
+                Iterator(const Entry* entry, const Entry* end) : entry_(entry), end_(end) {
+                    skip_tombstones();
+                }
+
+                reference operator*() const { return entry_->label; }
+
+                Iterator& operator++() {
+                    ++entry_;
+                    skip_tombstones();
+                    return *this;
+                }
+
+                Iterator operator++(int) {
+                    auto it = *this;
+                    ++(*this);
+                    return it;
+                }
+
+                bool operator==(const Iterator& rhs) const { return entry_ == rhs.entry_; }
+
+            private:
+                void skip_tombstones() {
+                    while (entry_ != end_ && entry_->label == nullptr) {
+                        ++entry_;
+                    }
+                }
+
+                const Entry* entry_ = nullptr;
+                const Entry* end_ = nullptr;
+        };
+
+        // Insert the label after the entries with a lower or equal cost.
+        void insert(Label<ResourceType>* label) {
+            const double cost = label->get_cost();
+            const auto it = std::ranges::upper_bound(entries_, cost, {}, &Entry::cost);
+            const auto position = static_cast<size_t>(it - entries_.begin());
+            const auto& entry =
+                *entries_.insert(it, {cost, label->get_dominance_signature(), label});
+
+            if (num_columns_ == 0 && numerical_ && is_numerical(entry)) {
+                // first label
+                num_columns_ = static_cast<size_t>(entry.signature.num_keys) + 1;
+            }
+            if (num_columns_ == 0 || !is_numerical(entry) ||
+                static_cast<size_t>(entry.signature.num_keys) + 1 != num_columns_) {
+                // e.g., a source label without signature
+                drop_columns();
+                return;
+            }
+            const auto point = get_point(entry);
+            for (size_t d = 0; d < num_columns_; ++d) {
+                columns_[d].insert(columns_[d].begin() + static_cast<std::ptrdiff_t>(position),
+                                   point[d]);
+            }
+            if (indexed_) {
+                index_.insert(point, entry);
+            } else if (size() >= MIN_INDEXED_LABELS) {
+                build_index();
+            }
+        }
+
+        // Replace the entry at the given index by a tombstone.
+        void erase_at(size_t index) {
+            if (indexed_) {
+                index_.erase(get_point(entries_[index]), entries_[index]);
+            }
+            tombstone_at(index);
+        }
+
+        bool erase(const Label<ResourceType>* label) {
+            for (size_t i = 0; i < entries_.size(); ++i) {
+                if (entries_[i].label == label) {
+                    erase_at(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Remove the tombstones if they represent at least half of the entries (and rebuild the
+        // index if needed).
+        void compact_if_needed() {
+            if (num_tombstones_ >= MIN_LABEL_BUCKET_TOMBSTONES &&
+                2 * num_tombstones_ >= entries_.size()) {
+                size_t new_size = 0;
+                for (size_t i = 0; i < entries_.size(); ++i) {
+                    if (entries_[i].label != nullptr) {
+                        entries_[new_size] = entries_[i];
+                        for (size_t d = 0; d < num_columns_; ++d) {
+                            columns_[d][new_size] = columns_[d][i];
+                        }
+                        ++new_size;
+                    }
+                }
+                entries_.resize(new_size);
+                for (size_t d = 0; d < num_columns_; ++d) {
+                    columns_[d].resize(new_size);
+                }
+                num_tombstones_ = 0;
+            }
+            if (indexed_ && index_.needs_rebuild()) {
+                build_index();
+            }
+        }
+
+        void clear() {
+            entries_.clear();
+            num_tombstones_ = 0;
+            for (auto& column : columns_) {
+                column.clear();
+            }
+            num_columns_ = 0;
+            numerical_ = true;
+            index_.clear();
+            indexed_ = false;
+        }
+
+        // Whether is_dominating(entry) for an entry of the bucket that may dominate a label with
+        // the given cost and signature (lower or equal cost, compatible signature).
+        template <typename Predicate>
+        bool any_dominating_candidate(double cost, const DominanceSignature& signature,
+                                      Predicate&& is_dominating) const {
+            const auto is_candidate = [&](const Entry& entry) {
+                return entry.signature.may_dominate(signature) && is_dominating(entry);
+            };
+            if (!has_columns_for(signature)) {
+                for (const auto& entry : entries_) {
+                    if (!value_leq(entry.cost, cost)) {
+                        break;
+                    }
+                    if (entry.label != nullptr && is_candidate(entry)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            const auto point = get_point(cost, signature);
+            if (indexed_) {
+                return index_.any_leq(point, is_candidate);
+            }
+            // the labels with a lower or equal cost, by batches
+            const auto end = static_cast<size_t>(
+                std::ranges::partition_point(
+                    entries_, [cost](const Entry& entry) { return value_leq(entry.cost, cost); }) -
+                entries_.begin());
+            const auto columns = get_columns();
+            for (size_t first = 0; first < end; first += dominance_kernels::MAX_BATCH_SIZE) {
+                uint64_t mask = dominance_kernels::leq_mask(
+                    columns.data(),
+                    num_columns_,
+                    first,
+                    std::min(dominance_kernels::MAX_BATCH_SIZE, end - first),
+                    point.data());
+                for (; mask != 0; mask &= mask - 1) {
+                    if (is_candidate(entries_[first + std::countr_zero(mask)])) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Erase the entries of the bucket that may be dominated by a label with the given cost and
+        // signature (greater or equal cost, compatible signature) and for which
+        // is_dominated(entry) is true.
+        template <typename Predicate>
+        void erase_dominated_candidates_if(double cost, const DominanceSignature& signature,
+                                           Predicate&& is_dominated) {
+            const auto is_candidate = [&](const Entry& entry) {
+                return signature.may_dominate(entry.signature) && is_dominated(entry);
+            };
+            const auto begin = static_cast<size_t>(
+                std::ranges::partition_point(
+                    entries_, [cost](const Entry& entry) { return !value_leq(cost, entry.cost); }) -
+                entries_.begin());
+            if (!has_columns_for(signature)) {
+                for (size_t i = begin; i < entries_.size(); ++i) {
+                    if (entries_[i].label != nullptr && is_candidate(entries_[i])) {
+                        erase_at(i);
+                    }
+                }
+                return;
+            }
+
+            const auto point = get_point(cost, signature);
+            if (indexed_) {
+                index_.erase_geq_if(point, [&](const Entry& entry) {
+                    if (is_candidate(entry)) {
+                        tombstone(entry);
+                        return true;
+                    }
+                    return false;
+                });
+                return;
+            }
+            // the labels with a greater or equal cost, by batches
+            const auto columns = get_columns();
+            for (size_t first = begin; first < entries_.size();
+                 first += dominance_kernels::MAX_BATCH_SIZE) {
+                uint64_t mask = dominance_kernels::geq_mask(
+                    columns.data(),
+                    num_columns_,
+                    first,
+                    std::min(dominance_kernels::MAX_BATCH_SIZE, entries_.size() - first),
+                    point.data());
+                for (; mask != 0; mask &= mask - 1) {
+                    const size_t i = first + std::countr_zero(mask);
+                    if (is_candidate(entries_[i])) {
+                        tombstone_at(i);
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] bool is_indexed() const { return indexed_; }
+
+        [[nodiscard]] size_t size() const { return entries_.size() - num_tombstones_; }
+
+        [[nodiscard]] bool empty() const { return size() == 0; }
+
+        // Whether the bucket contains a label with a lower or equal cost (i.e., the first one).
+        [[nodiscard]] bool has_cost_leq(double cost) const {
+            const auto it = std::ranges::find_if(
+                entries_, [](const Entry& entry) { return entry.label != nullptr; });
+            return it != entries_.end() && it->cost <= cost;
+        }
+
+        // Memory allocated by the bucket in bytes (not including the labels).
+        [[nodiscard]] size_t get_memory_usage() const {
+            size_t memory_usage = entries_.capacity() * sizeof(Entry) + index_.get_memory_usage();
+            for (const auto& column : columns_) {
+                memory_usage += column.capacity() * sizeof(double);
+            }
+            return memory_usage;
+        }
+
+        // All the entries sorted by cost, including the tombstones.
+        [[nodiscard]] const std::vector<Entry>& entries() const { return entries_; }
+
+        [[nodiscard]] Iterator begin() const {
+            return Iterator(entries_.data(), entries_.data() + entries_.size());
+        }
+
+        [[nodiscard]] Iterator end() const {
+            return Iterator(entries_.data() + entries_.size(), entries_.data() + entries_.size());
+        }
+
+    private:
+        using Index = DominanceIndex<Entry>;
+
+        // Whether the signature of the entry has numerical keys (to store them by columns).
+        [[nodiscard]] static bool is_numerical(const Entry& entry) {
+            return entry.signature.valid && entry.signature.num_keys > 0;
+        }
+
+        // Whether the columns can be compared with the label with the given signature.
+        [[nodiscard]] bool has_columns_for(const DominanceSignature& signature) const {
+            return num_columns_ != 0 && signature.valid &&
+                   static_cast<size_t>(signature.num_keys) + 1 == num_columns_;
+        }
+
+        [[nodiscard]] std::array<const double*, Index::MAX_DIMENSIONS> get_columns() const {
+            std::array<const double*, Index::MAX_DIMENSIONS> columns{};
+            for (size_t d = 0; d < num_columns_; ++d) {
+                columns[d] = columns_[d].data();
+            }
+            return columns;
+        }
+
+        // Stop storing the keys by columns and indexing them (e.g., after the insertion of a
+        // label without signature): the queries scan the entries until the next clear.
+        void drop_columns() {
+            for (auto& column : columns_) {
+                column.clear();
+            }
+            num_columns_ = 0;
+            numerical_ = false;
+            index_.clear();
+            indexed_ = false;
+        }
+
+        [[nodiscard]] static typename Index::Point get_point(double cost,
+                                                            const DominanceSignature& signature) {
+            typename Index::Point point{};
+            point[0] = cost;
+            std::copy_n(signature.keys.begin(), signature.num_keys, point.begin() + 1);
+            return point;
+        }
+
+        [[nodiscard]] static typename Index::Point get_point(const Entry& entry) {
+            return get_point(entry.cost, entry.signature);
+        }
+
+        // Index the labels (stored by columns).
+        void build_index() {
+            std::vector<std::pair<typename Index::Point, Entry>> points;
+            points.reserve(size());
+            for (const auto& entry : entries_) {
+                if (entry.label != nullptr) {
+                    points.emplace_back(get_point(entry), entry);
+                }
+            }
+            index_.build(std::move(points), num_columns_);
+            indexed_ = true;
+        }
+
+        // Replace the entry at the given index by a tombstone, without erasing it from the index
+        // (a NaN cost is never lower nor greater or equal in the columns).
+        void tombstone_at(size_t index) {
+            entries_[index].label = nullptr;
+            if (num_columns_ != 0) {
+                columns_[0][index] = std::numeric_limits<double>::quiet_NaN();
+            }
+            ++num_tombstones_;
+        }
+
+        // Replace the entry of the label (found by its cost) by a tombstone, without erasing it
+        // from the index.
+        void tombstone(const Entry& entry) {
+            auto it = std::ranges::lower_bound(entries_, entry.cost, {}, &Entry::cost);
+            for (; it != entries_.end() && it->cost == entry.cost; ++it) {
+                if (it->label == entry.label) {
+                    tombstone_at(static_cast<size_t>(it - entries_.begin()));
+                    return;
+                }
+            }
+        }
+
+        std::vector<Entry> entries_;
+        size_t num_tombstones_ = 0;
+
+        // Costs and keys of the entries by columns (see get_point), if num_columns_ != 0.
+        std::array<std::vector<double>, Index::MAX_DIMENSIONS> columns_;
+        size_t num_columns_ = 0;
+        // Whether all the labels inserted since the last clear have numerical signatures.
+        bool numerical_ = true;
+
+        // Index of the labels (see MIN_INDEXED_LABELS).
+        Index index_;
+        bool indexed_ = false;
+};
+}  // namespace rcspp
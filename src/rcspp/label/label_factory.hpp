@@ -18,16 +18,17 @@ class LabelFactory {
         explicit LabelFactory(ResourceFactory<ResourceType>* resource_factory)
             : resource_factory_(*resource_factory) {}
 
-        std::unique_ptr<Label<ResourceType>> make_label(
-            size_t label_id, const Node<ResourceType>* end_node,
-            const Arc<ResourceType>* in_arc = nullptr, const Arc<ResourceType>* out_arc = nullptr) {
-            auto resource = resource_factory_.make_resource(*end_node->resource);
-
-            return std::make_unique<Label<ResourceType>>(label_id,
-                                                         std::move(resource),
-                                                         end_node,
-                                                         in_arc,
-                                                         out_arc);
+        // Construct a new label at the given (uninitialized) location.
+        Label<ResourceType>* make_label(Label<ResourceType>* label_location, size_t label_id,
+                                        const Node<ResourceType>* end_node,
+                                        const Arc<ResourceType>* in_arc = nullptr,
+                                        const Arc<ResourceType>* out_arc = nullptr) {
+            return std::construct_at(label_location,
+                                     label_id,
+                                     resource_factory_.make_resource_value(*end_node->resource),
+                                     end_node,
+                                     in_arc,
+                                     out_arc);
         }
 
         static void reset_label(Label<ResourceType>* label, size_t label_id,
@@ -38,7 +39,10 @@ class LabelFactory {
             label->end_node_ = end_node;
             label->in_arc_ = in_arc;
             label->out_arc_ = out_arc;
+            label->parent_ = nullptr;
+            label->num_references_.store(1, std::memory_order_relaxed);
             label->dominated = false;
+            label->dominance_signature_ = DominanceSignature();
 
             label->get_resource().reset(*end_node->resource);
         }
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -14,27 +16,39 @@ namespace rcspp {
 
 inline constexpr size_t DEFAULT_LABEL_POOL_SIZE = 1e4;
 
+/**
+ * @brief Pool of the labels (and their resources) used by an algorithm.
+ *
+ * The labels are constructed in place in slabs of contiguous memory, and are never moved nor
+ * destroyed before the pool is cleared or destroyed. A released label is reused before any other
+ * label. Resetting the pool (e.g., at the beginning of a solve) is O(1): the labels constructed by
+ * the previous solves are reused in order, so that consecutive solves do not allocate memory once
+ * the pool is large enough.
+ */
 template <typename ResourceType>
     requires std::derived_from<ResourceType, ResourceBase<ResourceType>>
 class LabelPool {
     public:
         explicit LabelPool(std::unique_ptr<LabelFactory<ResourceType>> label_factory,
                            size_t initial_size = DEFAULT_LABEL_POOL_SIZE)
-            : label_factory_(std::move(label_factory)) {
-            labels_.reserve(initial_size);
+            : label_factory_(std::move(label_factory)),
+              slab_size_(std::max<size_t>(initial_size, 1)) {
             available_labels_.reserve(initial_size);
         }
 
+        LabelPool(const LabelPool&) = delete;
+        LabelPool& operator=(const LabelPool&) = delete;
+
+        ~LabelPool() { clear(); }
+
         std::unique_ptr<LabelPool<ResourceType>> clone() {
             return std::make_unique<LabelPool<ResourceType>>(
-                std::make_unique<LabelFactory<ResourceType>>(*label_factory_));
+                std::make_unique<LabelFactory<ResourceType>>(*label_factory_), slab_size_);
         }
 
         Label<ResourceType>& get_next_label(const Node<ResourceType>* end_node,
                                             const Arc<ResourceType>* in_arc = nullptr,
                                             const Arc<ResourceType>* out_arc = nullptr) {
-            // size_t label_id = 0;
-
             Label<ResourceType>* label_ptr = nullptr;
 
             if (!available_labels_.empty()) {
@@ -43,31 +57,87 @@ class LabelPool {
                 label_factory_->reset_label(label_ptr, nb_labels_, end_node, in_arc, out_arc);
                 ++nb_reused_labels_;
             } else {
-                // A new label is created
-                labels_.emplace_back(
-                    label_factory_->make_label(nb_labels_, end_node, in_arc, out_arc));
-                label_ptr = labels_.back().get();
-                ++nb_created_labels_;
+                // next label of the slabs
+                if (current_slab_ < slabs_.size() &&
+                    current_index_ == slabs_[current_slab_].capacity) {
+                    ++current_slab_;
+                    current_index_ = 0;
+                }
+                if (current_slab_ == slabs_.size()) {
+                    slabs_.push_back({allocator_.allocate(slab_size_), slab_size_, 0});
+                }
+
+                auto& slab = slabs_[current_slab_];
+                label_ptr = slab.labels + current_index_;
+                if (current_index_ < slab.num_constructed) {
+                    // A label of a previous solve is reused
+                    label_factory_->reset_label(label_ptr, nb_labels_, end_node, in_arc, out_arc);
+                    ++nb_reused_labels_;
+                } else {
+                    // A new label is created
+                    label_factory_->make_label(label_ptr, nb_labels_, end_node, in_arc, out_arc);
+                    ++slab.num_constructed;
+                    ++nb_created_labels_;
+                }
+                ++current_index_;
             }
             ++nb_labels_;
 
             return *label_ptr;
         }
 
+        // Release a label. It is only reused once all the labels extended from it have been
+        // released too, so that the parent of a label in use is always valid. Reusing a label
+        // releases its reference to its parent.
         void release_label(Label<ResourceType>* label_ptr) {
-            available_labels_.push_back(label_ptr);
+            while (label_ptr != nullptr &&
+                   label_ptr->num_references_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                available_labels_.push_back(label_ptr);
+                // the labels are owned by the pools: the parent can be modified once released
+                label_ptr = const_cast<Label<ResourceType>*>(label_ptr->parent_);  // NOLINT
+            }
         }
 
         void release_all_labels() {
             available_labels_.clear();
-            for (auto& label_uptr : labels_) {
-                available_labels_.push_back(label_uptr.get());
+            for (size_t slab_index = 0; slab_index <= current_slab_ && slab_index < slabs_.size();
+                 ++slab_index) {
+                const auto& slab = slabs_[slab_index];
+                const size_t num_labels =
+                    slab_index == current_slab_ ? current_index_ : slab.capacity;
+                for (size_t i = 0; i < num_labels; ++i) {
+                    available_labels_.push_back(slab.labels + i);
+                }
             }
         }
 
-        void clear() {
-            labels_.clear();
+        // Make all the labels available again, in O(1). The memory is kept for the next solves.
+        void reset() {
             available_labels_.clear();
+            current_slab_ = 0;
+            current_index_ = 0;
+        }
+
+        // Destroy all the labels and free their memory.
+        void clear() {
+            for (auto& slab : slabs_) {
+                std::destroy_n(slab.labels, slab.num_constructed);
+                allocator_.deallocate(slab.labels, slab.capacity);
+            }
+            slabs_.clear();
+            reset();
+        }
+
+        // Number of labels obtained since the last reset and not released yet.
+        [[nodiscard]] size_t get_number_of_labels_in_use() const {
+            return (current_slab_ * slab_size_) + current_index_ - available_labels_.size();
+        }
+
+        // Memory allocated by the pool in bytes, excluding the memory owned by the resources of
+        // the labels.
+        [[nodiscard]] size_t get_memory_usage() const {
+            return (slabs_.size() * slab_size_ * sizeof(Label<ResourceType>)) +
+                   (available_labels_.capacity() * sizeof(Label<ResourceType>*));
         }
 
         [[nodiscard]] int64_t get_nb_created_labels() const { return nb_created_labels_; }
@@ -75,10 +145,22 @@ class LabelPool {
         [[nodiscard]] int64_t get_nb_reused_labels() const { return nb_reused_labels_; }
 
     private:
+        struct Slab {
+                Label<ResourceType>* labels;
+                size_t capacity;
+                size_t num_constructed;  // the labels are constructed in order
+        };
+
         std::unique_ptr<LabelFactory<ResourceType>> label_factory_;
-        std::vector<std::unique_ptr<Label<ResourceType>>> labels_;
+        std::allocator<Label<ResourceType>> allocator_;
+        size_t slab_size_;
+        std::vector<Slab> slabs_;
         std::vector<Label<ResourceType>*> available_labels_;
 
+        // position of the next label of the slabs that has not been used since the last reset
+        size_t current_slab_{0};
+        size_t current_index_{0};
+
         uint64_t nb_labels_{0};
         uint64_t nb_created_labels_{0};
         uint64_t nb_reused_labels_{0};
@@ -5,6 +5,7 @@
 
 #include <vector>
 
+#include "rcspp/graph/arc_mask.hpp"
 #include "rcspp/graph/graph.hpp"
 
 namespace rcspp {
@@ -26,6 +27,20 @@ class Preprocessor {
             return !arc_ids.empty();
         }
 
+        // Arcs that preprocess() would remove, without modifying the graph.
+        ArcMask make_arc_mask() {
+            ArcMask arc_mask;
+            if (disable_preprocessing_) {
+                return arc_mask;
+            }
+            for (const auto& [arc_id, arc_ptr] : graph_->get_arcs_by_id()) {
+                if (remove_arc(*arc_ptr)) {
+                    arc_mask.remove(arc_id);
+                }
+            }
+            return arc_mask;
+        }
+
         virtual void restore() {
             for (const auto& arc_id : removed_arcs_by_id_) {
                 graph_->restore_arc(arc_id);
@@ -45,6 +45,9 @@ class ShortestPathPreprocessor final : public Preprocessor<ResourceComposition<R
             }
         }
 
+        // Lower bounds on the cost from each node to a sink (empty if not computed).
+        [[nodiscard]] const Distance& get_dist_to_sinks() const { return dist_to_sinks_; }
+
     private:
         Distance dist_from_sources_, dist_to_sinks_;
         size_t cost_index_;
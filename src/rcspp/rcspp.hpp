@@ -2,19 +2,31 @@
 #pragma once
 
 #include "rcspp/algorithm/algorithm.hpp"
+#include "rcspp/algorithm/best_first_dominance_algorithm.hpp"
+#include "rcspp/algorithm/bidirectional_dominance_algorithm.hpp"
+#include "rcspp/algorithm/bucket_dominance_algorithm.hpp"
+#include "rcspp/algorithm/cancellation_token.hpp"
 #include "rcspp/algorithm/diversification_search.hpp"
 #include "rcspp/algorithm/dominance_algorithm.hpp"
 #include "rcspp/algorithm/greedy.hpp"
+#include "rcspp/algorithm/parallel_diversification_search.hpp"
+#include "rcspp/algorithm/parallel_dominance_algorithm.hpp"
+#include "rcspp/algorithm/portfolio_algorithm.hpp"
 #include "rcspp/algorithm/pulling_dominance_algorithm.hpp"
 #include "rcspp/algorithm/pushing_dominance_algorithm.hpp"
+#include "rcspp/algorithm/shared_search_state.hpp"
 #include "rcspp/algorithm/simple_dominance_algorithm.hpp"
 #include "rcspp/algorithm/solution.hpp"
 #include "rcspp/general/clonable.hpp"
 #include "rcspp/graph/arc.hpp"
+#include "rcspp/graph/arc_mask.hpp"
 #include "rcspp/graph/graph.hpp"
 #include "rcspp/graph/node.hpp"
 #include "rcspp/graph/row.hpp"
+#include "rcspp/label/dominance_index.hpp"
+#include "rcspp/label/dominance_kernels.hpp"
 #include "rcspp/label/label.hpp"
+#include "rcspp/label/label_bucket.hpp"
 #include "rcspp/label/label_factory.hpp"
 #include "rcspp/label/label_pool.hpp"
 #include "rcspp/preprocessor/bellman_ford_algorithm.hpp"
@@ -29,12 +41,18 @@
 #include "rcspp/resource/base/resource_factory.hpp"
 #include "rcspp/resource/composition/functions/cost/component_cost_function.hpp"
 #include "rcspp/resource/composition/functions/cost/composition_cost_function.hpp"
+#include "rcspp/resource/composition/functions/cost/static_component_cost_function.hpp"
 #include "rcspp/resource/composition/functions/dominance/component_dominance_function.hpp"
 #include "rcspp/resource/composition/functions/dominance/composition_dominance_function.hpp"
+#include "rcspp/resource/composition/functions/dominance/static_composition_dominance_function.hpp"
 #include "rcspp/resource/composition/functions/extension/composition_extension_function.hpp"
+#include "rcspp/resource/composition/functions/extension/static_composition_extension_function.hpp"
 #include "rcspp/resource/composition/functions/feasibility/composition_feasibility_function.hpp"
+#include "rcspp/resource/composition/functions/feasibility/static_composition_feasibility_function.hpp"
 #include "rcspp/resource/composition/resource_composition.hpp"
 #include "rcspp/resource/composition/resource_composition_factory.hpp"
+#include "rcspp/resource/composition/static_component.hpp"
+#include "rcspp/resource/concrete/bitset_kernels.hpp"
 #include "rcspp/resource/concrete/container_resource.hpp"
 #include "rcspp/resource/concrete/functions/cost/value_cost_function.hpp"
 #include "rcspp/resource/concrete/functions/dominance/inclusion_dominance_function.hpp"
@@ -51,6 +69,7 @@
 #include "rcspp/resource/functions/cost/cost_function.hpp"
 #include "rcspp/resource/functions/cost/trivial_cost_function.hpp"
 #include "rcspp/resource/functions/dominance/dominance_function.hpp"
+#include "rcspp/resource/functions/dominance/dominance_signature.hpp"
 #include "rcspp/resource/functions/dominance/trivial_dominance_function.hpp"
 #include "rcspp/resource/functions/extension/extension_function.hpp"
 #include "rcspp/resource/functions/extension/trivial_extension_function.hpp"
@@ -40,6 +40,10 @@ class Extender : public ResourceType {
 
         [[nodiscard]] auto get_arc_id() const -> size_t { return arc_id_; }
 
+        [[nodiscard]] auto get_extension_function() const -> ExtensionFunction<ResourceType>* {
+            return extension_function_.get();
+        }
+
         template <typename GraphResourceType>
         [[nodiscard]] auto clone(const Arc<GraphResourceType>& arc) const
             -> std::unique_ptr<Extender<ResourceType>> {
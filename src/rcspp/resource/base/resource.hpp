@@ -117,14 +117,20 @@ class Resource : public ResourceType {
               cost_function_(std::move(cost_function)),
               node_id_(0) {}
 
+        // The function objects are cloned if they are owned by rhs_resource, shared otherwise.
         Resource(Resource const& rhs_resource)
             : ResourceType(rhs_resource),
-              unique_dominance_function_(rhs_resource.unique_dominance_function_->clone()),
-              unique_feasibility_function_(rhs_resource.unique_feasibility_function_->clone()),
-              unique_cost_function_(rhs_resource.unique_cost_function_->clone()),
-              dominance_function_(unique_dominance_function_.get()),
-              feasibility_function_(unique_feasibility_function_.get()),
-              cost_function_(unique_cost_function_.get()),
+              unique_dominance_function_(clone_function(rhs_resource.unique_dominance_function_)),
+              unique_feasibility_function_(
+                  clone_function(rhs_resource.unique_feasibility_function_)),
+              unique_cost_function_(clone_function(rhs_resource.unique_cost_function_)),
+              dominance_function_(unique_dominance_function_ ? unique_dominance_function_.get()
+                                                             : rhs_resource.dominance_function_),
+              feasibility_function_(unique_feasibility_function_
+                                        ? unique_feasibility_function_.get()
+                                        : rhs_resource.feasibility_function_),
+              cost_function_(unique_cost_function_ ? unique_cost_function_.get()
+                                                   : rhs_resource.cost_function_),
               node_id_(rhs_resource.get_node_id()) {}
 
         Resource(Resource&& rhs_resource) : Resource() { swap(*this, rhs_resource); }
@@ -141,6 +147,10 @@ class Resource : public ResourceType {
         friend void swap(Resource& first, Resource& second) {
             using std::swap;
 
+            swap(static_cast<ResourceType&>(first), static_cast<ResourceType&>(second));
+            swap(first.unique_dominance_function_, second.unique_dominance_function_);
+            swap(first.unique_feasibility_function_, second.unique_feasibility_function_);
+            swap(first.unique_cost_function_, second.unique_cost_function_);
             swap(first.dominance_function_, second.dominance_function_);
             swap(first.feasibility_function_, second.feasibility_function_);
             swap(first.cost_function_, second.cost_function_);
@@ -152,6 +162,18 @@ class Resource : public ResourceType {
             return dominance_function_->check_dominance(*this, rhs_resource);
         }
 
+        // Signature to reject most non-dominance cases before operator<= (see DominanceSignature),
+        // invalid if the resource has no dominance function.
+        [[nodiscard]] auto get_dominance_signature() const -> DominanceSignature {
+            DominanceSignature signature;
+            if (dominance_function_ != nullptr) {
+                signature.exact = true;
+                dominance_function_->add_to_signature(*this, &signature);
+                signature.valid = true;
+            }
+            return signature;
+        }
+
         // Return resource cost
         [[nodiscard]] auto get_cost() const -> double { return cost_function_->get_cost(*this); }
 
@@ -167,6 +189,20 @@ class Resource : public ResourceType {
 
         [[nodiscard]] auto get_node_id() const -> size_t { return node_id_; }
 
+        // Function objects of the resource (e.g., to call them without virtual dispatch when their
+        // concrete types are known, see StaticComponent).
+        [[nodiscard]] auto get_dominance_function() const -> DominanceFunction<ResourceType>* {
+            return dominance_function_;
+        }
+
+        [[nodiscard]] auto get_feasibility_function() const -> FeasibilityFunction<ResourceType>* {
+            return feasibility_function_;
+        }
+
+        [[nodiscard]] auto get_cost_function() const -> CostFunction<ResourceType>* {
+            return cost_function_;
+        }
+
         [[nodiscard]] auto create(const size_t node_id) const
             -> std::unique_ptr<Resource<ResourceType>> {
             auto new_resource =
@@ -200,6 +236,11 @@ class Resource : public ResourceType {
             return new_resource;
         }
 
+        // Same as copy(), without allocating the new resource (e.g., to store it in a vector).
+        [[nodiscard]] auto copy_value() const -> Resource<ResourceType> {
+            return Resource(dominance_function_, feasibility_function_, cost_function_, node_id_);
+        }
+
         void reset(const size_t node_id) {
             // Reset the associated ResourceBase.
             ResourceType::reset();
@@ -224,6 +265,12 @@ class Resource : public ResourceType {
         }
 
     private:
+        template <typename FunctionType>
+        static auto clone_function(const std::unique_ptr<FunctionType>& function)
+            -> std::unique_ptr<FunctionType> {
+            return function ? function->clone() : nullptr;
+        }
+
         std::unique_ptr<DominanceFunction<ResourceType>> unique_dominance_function_;
         std::unique_ptr<FeasibilityFunction<ResourceType>> unique_feasibility_function_;
         std::unique_ptr<CostFunction<ResourceType>> unique_cost_function_;
@@ -243,6 +290,8 @@ class Resource<ResourceComposition<ResourceTypes...>>
         friend class ResourceCompositionFactory<ResourceTypes...>;
 
     public:
+        using ResourceComponents = std::tuple<std::vector<Resource<ResourceTypes>>...>;
+
         Resource()
             : unique_dominance_function_(nullptr),
               unique_feasibility_function_(nullptr),
@@ -268,8 +317,7 @@ class Resource<ResourceComposition<ResourceTypes...>>
               cost_function_(unique_cost_function_.get()),
               node_id_(node_id) {}
 
-        Resource(std::tuple<std::vector<std::unique_ptr<Resource<ResourceTypes>>>...>
-                     resource_components,
+        Resource(ResourceComponents resource_components,
                  std::unique_ptr<DominanceFunction<ResourceComposition<ResourceTypes...>>>
                      dominance_function,
                  std::unique_ptr<FeasibilityFunction<ResourceComposition<ResourceTypes...>>>
@@ -339,8 +387,7 @@ class Resource<ResourceComposition<ResourceTypes...>>
               cost_function_(std::move(cost_function)),
               node_id_(node_id) {}
 
-        Resource(std::tuple<std::vector<std::unique_ptr<Resource<ResourceTypes>>>...>
-                     resource_components,
+        Resource(ResourceComponents resource_components,
                  DominanceFunction<ResourceComposition<ResourceTypes...>>* dominance_function,
                  FeasibilityFunction<ResourceComposition<ResourceTypes...>>* feasibility_function,
                  CostFunction<ResourceComposition<ResourceTypes...>>* cost_function,
@@ -379,27 +426,22 @@ class Resource<ResourceComposition<ResourceTypes...>>
               cost_function_(std::move(cost_function)),
               node_id_(0) {}
 
+        // The function objects are cloned if they are owned by rhs_resource, shared otherwise.
         Resource(Resource const& rhs_resource)
             : ResourceComposition<ResourceTypes...>(rhs_resource),
-              unique_dominance_function_(rhs_resource.unique_dominance_function_->clone()),
-              unique_feasibility_function_(rhs_resource.unique_feasibility_function_->clone()),
-              unique_cost_function_(rhs_resource.unique_cost_function_->clone()),
-              dominance_function_(unique_dominance_function_.get()),
-              feasibility_function_(unique_feasibility_function_.get()),
-              cost_function_(unique_cost_function_.get()),
-              node_id_(rhs_resource.get_node_id()) {
-            // Apply clone_res_vec_function to each component of the tuple
-            // resource_base_components_.
-            std::apply(
-                [&](auto&&... args_res_comp) -> auto {
-                    std::apply(
-                        [&](auto&&... args_rhs_res_comp) -> auto {
-                            (clone_resource_vector(&args_res_comp, args_rhs_res_comp), ...);
-                        },
-                        rhs_resource.resource_components_);
-                },
-                resource_components_);
-        }
+              resource_components_(rhs_resource.resource_components_),
+              unique_dominance_function_(clone_function(rhs_resource.unique_dominance_function_)),
+              unique_feasibility_function_(
+                  clone_function(rhs_resource.unique_feasibility_function_)),
+              unique_cost_function_(clone_function(rhs_resource.unique_cost_function_)),
+              dominance_function_(unique_dominance_function_ ? unique_dominance_function_.get()
+                                                             : rhs_resource.dominance_function_),
+              feasibility_function_(unique_feasibility_function_
+                                        ? unique_feasibility_function_.get()
+                                        : rhs_resource.feasibility_function_),
+              cost_function_(unique_cost_function_ ? unique_cost_function_.get()
+                                                   : rhs_resource.cost_function_),
+              node_id_(rhs_resource.get_node_id()) {}
 
         Resource(Resource&& rhs_resource) : Resource() { swap(*this, rhs_resource); }
 
@@ -415,6 +457,12 @@ class Resource<ResourceComposition<ResourceTypes...>>
         friend void swap(Resource& first, Resource& second) {
             using std::swap;
 
+            swap(static_cast<ResourceComposition<ResourceTypes...>&>(first),
+                 static_cast<ResourceComposition<ResourceTypes...>&>(second));
+            swap(first.resource_components_, second.resource_components_);
+            swap(first.unique_dominance_function_, second.unique_dominance_function_);
+            swap(first.unique_feasibility_function_, second.unique_feasibility_function_);
+            swap(first.unique_cost_function_, second.unique_cost_function_);
             swap(first.dominance_function_, second.dominance_function_);
             swap(first.feasibility_function_, second.feasibility_function_);
             swap(first.cost_function_, second.cost_function_);
@@ -426,6 +474,18 @@ class Resource<ResourceComposition<ResourceTypes...>>
             return dominance_function_->check_dominance(*this, rhs_resource);
         }
 
+        // Signature to reject most non-dominance cases before operator<= (see DominanceSignature),
+        // invalid if the resource has no dominance function.
+        [[nodiscard]] auto get_dominance_signature() const -> DominanceSignature {
+            DominanceSignature signature;
+            if (dominance_function_ != nullptr) {
+                signature.exact = true;
+                dominance_function_->add_to_signature(*this, &signature);
+                signature.valid = true;
+            }
+            return signature;
+        }
+
         // Return resource cost
         [[nodiscard]] auto get_cost() const -> double { return cost_function_->get_cost(*this); }
 
@@ -446,16 +506,15 @@ class Resource<ResourceComposition<ResourceTypes...>>
 
         [[nodiscard]] auto create(const size_t node_id) const
             -> std::unique_ptr<Resource<ResourceComposition<ResourceTypes...>>> {
-            std::tuple<std::vector<std::unique_ptr<Resource<ResourceTypes>>>...>
-                new_resource_components;
+            ResourceComponents new_resource_components;
 
             // Create a resource based on the resources contained in a single vector of resources.
             const auto create_res_vec_function = [&](auto& sing_new_res_vec,
                                                      const auto& sing_res_vec) -> auto {
-                std::transform(sing_res_vec.begin(),
-                               sing_res_vec.end(),
-                               std::back_inserter(sing_new_res_vec),
-                               [node_id](const auto& res) { return res->create(node_id); });
+                sing_new_res_vec.reserve(sing_res_vec.size());
+                for (const auto& res : sing_res_vec) {
+                    sing_new_res_vec.push_back(std::move(*res.create(node_id)));
+                }
             };
 
             // Apply create_res_vec_function to each component of the tuple resource_components_.
@@ -478,8 +537,12 @@ class Resource<ResourceComposition<ResourceTypes...>>
 
         [[nodiscard]] auto copy() const
             -> std::unique_ptr<Resource<ResourceComposition<ResourceTypes...>>> {
-            std::tuple<std::vector<std::unique_ptr<Resource<ResourceTypes>>>...>
-                new_resource_components;
+            return std::make_unique<Resource>(copy_value());
+        }
+
+        // Same as copy(), without allocating the new resource (e.g., to store it in a label).
+        [[nodiscard]] auto copy_value() const -> Resource<ResourceComposition<ResourceTypes...>> {
+            ResourceComponents new_resource_components;
 
             // Apply create_res_vec_function to each component of the tuple resource_components_.
             std::apply(
@@ -492,22 +555,20 @@ class Resource<ResourceComposition<ResourceTypes...>>
                 },
                 new_resource_components);
 
-            return std::make_unique<Resource>(std::move(new_resource_components),
-                                              dominance_function_,
-                                              feasibility_function_,
-                                              cost_function_,
-                                              node_id_);
+            return Resource(std::move(new_resource_components),
+                            dominance_function_,
+                            feasibility_function_,
+                            cost_function_,
+                            node_id_);
         }
 
         // New methods
 
-        [[nodiscard]] auto get_resource_components()
-            -> std::tuple<std::vector<std::unique_ptr<Resource<ResourceTypes>>>...>& {
+        [[nodiscard]] auto get_resource_components() -> ResourceComponents& {
             return resource_components_;
         }
 
-        [[nodiscard]] auto get_resource_components() const
-            -> const std::tuple<std::vector<std::unique_ptr<Resource<ResourceTypes>>>...>& {
+        [[nodiscard]] auto get_resource_components() const -> const ResourceComponents& {
             return resource_components_;
         }
 
@@ -523,7 +584,7 @@ class Resource<ResourceComposition<ResourceTypes...>>
 
         template <size_t ResourceTypeIndex>
         [[nodiscard]] auto get_resource_component(size_t resource_index) const -> const auto& {
-            return *(std::get<ResourceTypeIndex>(resource_components_)[resource_index]);
+            return std::get<ResourceTypeIndex>(resource_components_)[resource_index];
         }
 
         template <typename ResourceType>
@@ -554,7 +615,7 @@ class Resource<ResourceComposition<ResourceTypes...>>
 
             auto reset_function = [&](auto& sing_res_vec) -> auto {
                 for (auto& res : sing_res_vec) {
-                    res->reset(node_id);
+                    res.reset(node_id);
                 }
             };
 
@@ -568,6 +629,17 @@ class Resource<ResourceComposition<ResourceTypes...>>
 
             node_id_ = resource.node_id_;
 
+            // shared function objects (e.g., of a node of another graph): use the new ones
+            if (!unique_dominance_function_) {
+                dominance_function_ = resource.dominance_function_;
+            }
+            if (!unique_feasibility_function_) {
+                feasibility_function_ = resource.feasibility_function_;
+            }
+            if (!unique_cost_function_) {
+                cost_function_ = resource.cost_function_;
+            }
+
             std::apply(
                 [&](auto&&... args_res_comp) -> auto {
                     std::apply(
@@ -580,37 +652,34 @@ class Resource<ResourceComposition<ResourceTypes...>>
         }
 
     private:
-        template <typename ResourceType>
-        void clone_resource_vector(
-            std::vector<std::unique_ptr<Resource<ResourceType>>>* resource_vector_to_ptr,
-            const std::vector<std::unique_ptr<Resource<ResourceType>>>& resource_vec_from) const {
-            std::transform(resource_vec_from.begin(),
-                           resource_vec_from.end(),
-                           std::back_inserter(*resource_vector_to_ptr),
-                           [](const auto& res) { return res->clone_resource(); });
-        }
-
         template <typename ResourceType>
         void copy_resource_vector(
-            std::vector<std::unique_ptr<Resource<ResourceType>>>* resource_vector_to_ptr,
-            const std::vector<std::unique_ptr<Resource<ResourceType>>>& resource_vec_from) const {
-            std::transform(resource_vec_from.begin(),
-                           resource_vec_from.end(),
-                           std::back_inserter(*resource_vector_to_ptr),
-                           [](const auto& res) { return res->copy(); });
+            std::vector<Resource<ResourceType>>* resource_vector_to_ptr,
+            const std::vector<Resource<ResourceType>>& resource_vec_from) const {
+            resource_vector_to_ptr->reserve(resource_vec_from.size());
+            for (const auto& res : resource_vec_from) {
+                resource_vector_to_ptr->push_back(res.copy_value());
+            }
         }
 
         template <typename ResourceType>
         void reset_resource_vector(
-            std::vector<std::unique_ptr<Resource<ResourceType>>>* resource_vector_to_ptr,
-            const std::vector<std::unique_ptr<Resource<ResourceType>>>& resource_vec_from) const {
-            for (int i = 0; i < resource_vector_to_ptr->size(); i++) {
-                (*resource_vector_to_ptr)[i]->reset(*resource_vec_from[i]);
+            std::vector<Resource<ResourceType>>* resource_vector_to_ptr,
+            const std::vector<Resource<ResourceType>>& resource_vec_from) const {
+            for (size_t i = 0; i < resource_vector_to_ptr->size(); i++) {
+                (*resource_vector_to_ptr)[i].reset(resource_vec_from[i]);
             }
         }
 
-        // New attribute
-        std::tuple<std::vector<std::unique_ptr<Resource<ResourceTypes>>>...> resource_components_;
+        template <typename FunctionType>
+        static auto clone_function(const std::unique_ptr<FunctionType>& function)
+            -> std::unique_ptr<FunctionType> {
+            return function ? function->clone() : nullptr;
+        }
+
+        // The components of each type are stored by value in a contiguous vector, so that
+        // copying or resetting a resource does not allocate a resource per component.
+        ResourceComponents resource_components_;
 
         std::unique_ptr<DominanceFunction<ResourceComposition<ResourceTypes...>>>
             unique_dominance_function_;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <concepts>
 #include <iostream>
 #include <memory>
@@ -75,6 +76,12 @@ class ResourceFactory {
             return resource.copy();
         }
 
+        // Same as make_resource(resource), without allocating the new resource.
+        auto make_resource_value(const Resource<ResourceType>& resource) -> Resource<ResourceType> {
+            ++nb_resources_created_;
+            return resource.copy_value();
+        }
+
         // Make an extender
         template <typename GraphResourceType>
         auto make_extender(const Arc<GraphResourceType>& arc)
@@ -124,8 +131,9 @@ class ResourceFactory {
         std::unique_ptr<Resource<ResourceType>> resource_prototype_;
         std::unique_ptr<ExtensionFunction<ResourceType>> extension_function_;
 
-        size_t nb_resource_bases_created_;
-        size_t nb_resources_created_;
-        size_t nb_extenders_created_;
+        // atomic, as labels can be created concurrently by parallel algorithms
+        std::atomic<size_t> nb_resource_bases_created_;
+        std::atomic<size_t> nb_resources_created_;
+        std::atomic<size_t> nb_extenders_created_;
 };
 }  // namespace rcspp
@@ -22,7 +22,7 @@ class CompositionCostFunction
 
             const auto res_cost_function = [&](const auto& sing_res_vec) {
                 for (auto&& res_comp : sing_res_vec) {
-                    total_cost += res_comp->get_cost();
+                    total_cost += res_comp.get_cost();
                 }
             };
 
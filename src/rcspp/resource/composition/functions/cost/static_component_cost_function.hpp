@@ -0,0 +1,38 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include "rcspp/general/clonable.hpp"
+#include "rcspp/resource/composition/resource_composition.hpp"
+#include "rcspp/resource/functions/cost/cost_function.hpp"
+
+namespace rcspp {
+
+// Same as ComponentCostFunction, with the cost function of the component known at compile time
+// (see StaticComponent).
+template <size_t ResourceTypeIndex, typename CostFunctionType, typename... ResourceTypes>
+class StaticComponentCostFunction
+    : public Clonable<StaticComponentCostFunction<ResourceTypeIndex, CostFunctionType,
+                                                  ResourceTypes...>,
+                      CostFunction<ResourceComposition<ResourceTypes...>>> {
+    public:
+        explicit StaticComponentCostFunction(size_t resource_index)
+            : resource_index_(resource_index) {}
+
+        [[nodiscard]] double get_cost(const Resource<ResourceComposition<ResourceTypes...>>&
+                                          resource_composition) const override {
+            const auto& resource =
+                resource_composition.template get_resource_component<ResourceTypeIndex>(
+                    resource_index_);
+            const auto* function =
+                static_cast<const CostFunctionType*>(resource.get_cost_function());
+
+            // qualified call: no virtual dispatch
+            return function->CostFunctionType::get_cost(resource);
+        }
+
+    private:
+        size_t resource_index_;
+};
+}  // namespace rcspp
@@ -29,6 +29,14 @@ class ComponentDominanceFunction
             return lhs_component_resource <= rhs_component_resource;
         }
 
+        void add_to_signature(const Resource<ResourceComposition<ResourceTypes...>>& resource,
+                              DominanceSignature* signature) override {
+            const auto& component_resource =
+                resource.template get_resource_component<ResourceTypeIndex>(resource_index_);
+            component_resource.get_dominance_function()->add_to_signature(component_resource,
+                                                                          signature);
+        }
+
     private:
         size_t resource_index_;
 };
@@ -34,15 +34,30 @@ class CompositionDominanceFunction
                 lhs_resource.get_resource_components());
         }
 
+        void add_to_signature(const Resource<ResourceComposition<ResourceTypes...>>& resource,
+                              DominanceSignature* signature) override {
+            std::apply(
+                [&](auto&&... sing_res_vecs) {
+                    (add_to_signature(sing_res_vecs, signature), ...);
+                },
+                resource.get_resource_components());
+        }
+
     private:
         bool check_dominance(const auto& lhs_sing_res_vec, const auto& rhs_sing_res_vec) {
             for (int i = 0; i < lhs_sing_res_vec.size(); i++) {
-                if (!(*lhs_sing_res_vec[i] <= *rhs_sing_res_vec[i])) {
+                if (!(lhs_sing_res_vec[i] <= rhs_sing_res_vec[i])) {
                     return false;
                 }
             }
 
             return true;
         }
+
+        void add_to_signature(const auto& sing_res_vec, DominanceSignature* signature) {
+            for (const auto& sing_res : sing_res_vec) {
+                sing_res.get_dominance_function()->add_to_signature(sing_res, signature);
+            }
+        }
 };
 }  // namespace rcspp
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <utility>
+
+#include "rcspp/general/clonable.hpp"
+#include "rcspp/resource/base/resource.hpp"
+#include "rcspp/resource/composition/resource_composition.hpp"
+#include "rcspp/resource/composition/static_component.hpp"
+#include "rcspp/resource/functions/dominance/dominance_function.hpp"
+
+namespace rcspp {
+
+template <typename CompositionType, typename... ComponentTypes>
+class StaticCompositionDominanceFunction;
+
+// Same as CompositionDominanceFunction, with the dominance functions of the components known at
+// compile time (see StaticComponent).
+template <typename... ResourceTypes, typename... ComponentTypes>
+class StaticCompositionDominanceFunction<ResourceComposition<ResourceTypes...>, ComponentTypes...>
+    : public Clonable<StaticCompositionDominanceFunction<ResourceComposition<ResourceTypes...>,
+                                                         ComponentTypes...>,
+                      DominanceFunction<ResourceComposition<ResourceTypes...>>> {
+    public:
+        bool check_dominance(
+            const Resource<ResourceComposition<ResourceTypes...>>& lhs_resource,
+            const Resource<ResourceComposition<ResourceTypes...>>& rhs_resource) override {
+            return check_components_dominance(lhs_resource,
+                                              rhs_resource,
+                                              std::index_sequence_for<ComponentTypes...>{});
+        }
+
+        void add_to_signature(const Resource<ResourceComposition<ResourceTypes...>>& resource,
+                              DominanceSignature* signature) override {
+            add_components_to_signature(resource,
+                                        signature,
+                                        std::index_sequence_for<ComponentTypes...>{});
+        }
+
+    private:
+        using Traits =
+            StaticComponentTraits<ResourceComposition<ResourceTypes...>, ComponentTypes...>;
+
+        template <size_t... ComponentIndices>
+        bool check_components_dominance(
+            const Resource<ResourceComposition<ResourceTypes...>>& lhs_resource,
+            const Resource<ResourceComposition<ResourceTypes...>>& rhs_resource,
+            std::index_sequence<ComponentIndices...> /*unused*/) const {
+            // The && operator acts as a break in the fold expression.
+            return (check_component_dominance<ComponentIndices>(lhs_resource, rhs_resource) &&
+                    ...);
+        }
+
+        template <size_t ComponentIndex>
+        bool check_component_dominance(
+            const Resource<ResourceComposition<ResourceTypes...>>& lhs_resource,
+            const Resource<ResourceComposition<ResourceTypes...>>& rhs_resource) const {
+            constexpr size_t ResourceTypeIndex =
+                Traits::template resource_type_index<ComponentIndex>;
+            constexpr size_t ResourceIndex = Traits::template resource_index<ComponentIndex>;
+            using FunctionType =
+                typename Traits::template Component<ComponentIndex>::DominanceFunctionType;
+
+            const auto& lhs_component =
+                lhs_resource.template get_resource_component<ResourceTypeIndex>(ResourceIndex);
+            const auto& rhs_component =
+                rhs_resource.template get_resource_component<ResourceTypeIndex>(ResourceIndex);
+            auto* function = static_cast<FunctionType*>(lhs_component.get_dominance_function());
+
+            // qualified call: no virtual dispatch
+            return function->FunctionType::check_dominance(lhs_component, rhs_component);
+        }
+
+        template <size_t... ComponentIndices>
+        void add_components_to_signature(
+            const Resource<ResourceComposition<ResourceTypes...>>& resource,
+            DominanceSignature* signature, std::index_sequence<ComponentIndices...> /*unused*/) {
+            (add_component_to_signature<ComponentIndices>(resource, signature), ...);
+        }
+
+        template <size_t ComponentIndex>
+        void add_component_to_signature(
+            const Resource<ResourceComposition<ResourceTypes...>>& resource,
+            DominanceSignature* signature) {
+            constexpr size_t ResourceTypeIndex =
+                Traits::template resource_type_index<ComponentIndex>;
+            constexpr size_t ResourceIndex = Traits::template resource_index<ComponentIndex>;
+            using FunctionType =
+                typename Traits::template Component<ComponentIndex>::DominanceFunctionType;
+
+            const auto& component =
+                resource.template get_resource_component<ResourceTypeIndex>(ResourceIndex);
+            auto* function = static_cast<FunctionType*>(component.get_dominance_function());
+
+            // qualified call: no virtual dispatch
+            function->FunctionType::add_to_signature(component, signature);
+        }
+};
+}  // namespace rcspp
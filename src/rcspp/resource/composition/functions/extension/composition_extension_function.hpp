@@ -59,9 +59,9 @@ class CompositionExtensionFunction
 
     private:
         void extend_resource(const auto& sing_res_vec, const auto& sing_exp_vec,
-                             const auto& extended_sing_res_vec) const {
+                             auto& extended_sing_res_vec) const {
             for (int i = 0; i < sing_res_vec.size(); i++) {
-                sing_exp_vec[i]->extend(*sing_res_vec[i], extended_sing_res_vec[i].get());
+                sing_exp_vec[i]->extend(sing_res_vec[i], &extended_sing_res_vec[i]);
             }
         }
 };
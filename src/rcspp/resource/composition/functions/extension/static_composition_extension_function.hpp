@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "rcspp/general/clonable.hpp"
+#include "rcspp/resource/base/extender.hpp"
+#include "rcspp/resource/composition/resource_composition.hpp"
+#include "rcspp/resource/composition/static_component.hpp"
+#include "rcspp/resource/functions/extension/extension_function.hpp"
+
+namespace rcspp {
+
+template <typename CompositionType, typename... ComponentTypes>
+class StaticCompositionExtensionFunction;
+
+// Same as CompositionExtensionFunction, with the extension functions of the components known at
+// compile time (see StaticComponent).
+template <typename... ResourceTypes, typename... ComponentTypes>
+class StaticCompositionExtensionFunction<ResourceComposition<ResourceTypes...>, ComponentTypes...>
+    : public Clonable<
+          StaticCompositionExtensionFunction<ResourceComposition<ResourceTypes...>,
+                                             ComponentTypes...>,
+          ExtensionFunction<ResourceComposition<ResourceTypes...>>> {
+    public:
+        void extend(const Resource<ResourceComposition<ResourceTypes...>>& resource,
+                    const Extender<ResourceComposition<ResourceTypes...>>& extender,
+                    Resource<ResourceComposition<ResourceTypes...>>* extended_resource) override {
+            extend_components(resource,
+                              extender,
+                              extended_resource,
+                              std::index_sequence_for<ComponentTypes...>{});
+        }
+
+    private:
+        using Traits =
+            StaticComponentTraits<ResourceComposition<ResourceTypes...>, ComponentTypes...>;
+
+        template <size_t... ComponentIndices>
+        void extend_components(const Resource<ResourceComposition<ResourceTypes...>>& resource,
+                               const Extender<ResourceComposition<ResourceTypes...>>& extender,
+                               Resource<ResourceComposition<ResourceTypes...>>* extended_resource,
+                               std::index_sequence<ComponentIndices...> /*unused*/) const {
+            (extend_component<ComponentIndices>(resource, extender, extended_resource), ...);
+        }
+
+        template <size_t ComponentIndex>
+        void extend_component(const Resource<ResourceComposition<ResourceTypes...>>& resource,
+                              const Extender<ResourceComposition<ResourceTypes...>>& extender,
+                              Resource<ResourceComposition<ResourceTypes...>>* extended_resource)
+            const {
+            constexpr size_t ResourceTypeIndex =
+                Traits::template resource_type_index<ComponentIndex>;
+            constexpr size_t ResourceIndex = Traits::template resource_index<ComponentIndex>;
+            using FunctionType =
+                typename Traits::template Component<ComponentIndex>::ExtensionFunctionType;
+
+            const auto& component_extender =
+                extender.template get_extender_component<ResourceTypeIndex>(ResourceIndex);
+            auto* function =
+                static_cast<FunctionType*>(component_extender.get_extension_function());
+
+            // qualified call: no virtual dispatch
+            function->FunctionType::extend(
+                resource.template get_resource_component<ResourceTypeIndex>(ResourceIndex),
+                component_extender,
+                &std::get<ResourceTypeIndex>(
+                    extended_resource->get_resource_components())[ResourceIndex]);
+        }
+};
+}  // namespace rcspp
@@ -34,7 +34,7 @@ class CompositionFeasibilityFunction
     private:
         bool check_feasibility(const auto& sing_res_vec, bool* is_feasible) {
             for (auto&& res_comp : sing_res_vec) {
-                if (!res_comp->is_feasible()) {
+                if (!res_comp.is_feasible()) {
                     *is_feasible = false;
                     return false;
                 }
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <utility>
+
+#include "rcspp/general/clonable.hpp"
+#include "rcspp/resource/composition/resource_composition.hpp"
+#include "rcspp/resource/composition/static_component.hpp"
+#include "rcspp/resource/functions/feasibility/feasibility_function.hpp"
+
+namespace rcspp {
+
+template <typename CompositionType, typename... ComponentTypes>
+class StaticCompositionFeasibilityFunction;
+
+// Same as CompositionFeasibilityFunction, with the feasibility functions of the components known
+// at compile time (see StaticComponent).
+template <typename... ResourceTypes, typename... ComponentTypes>
+class StaticCompositionFeasibilityFunction<ResourceComposition<ResourceTypes...>,
+                                           ComponentTypes...>
+    : public Clonable<StaticCompositionFeasibilityFunction<ResourceComposition<ResourceTypes...>,
+                                                           ComponentTypes...>,
+                      FeasibilityFunction<ResourceComposition<ResourceTypes...>>> {
+    public:
+        bool is_feasible(
+            const Resource<ResourceComposition<ResourceTypes...>>& resource_composition) override {
+            return are_components_feasible(resource_composition,
+                                           std::index_sequence_for<ComponentTypes...>{});
+        }
+
+    private:
+        using Traits =
+            StaticComponentTraits<ResourceComposition<ResourceTypes...>, ComponentTypes...>;
+
+        template <size_t... ComponentIndices>
+        bool are_components_feasible(
+            const Resource<ResourceComposition<ResourceTypes...>>& resource_composition,
+            std::index_sequence<ComponentIndices...> /*unused*/) const {
+            // The && operator acts as a break in the fold expression.
+            return (is_component_feasible<ComponentIndices>(resource_composition) && ...);
+        }
+
+        template <size_t ComponentIndex>
+        bool is_component_feasible(
+            const Resource<ResourceComposition<ResourceTypes...>>& resource_composition) const {
+            using FunctionType =
+                typename Traits::template Component<ComponentIndex>::FeasibilityFunctionType;
+
+            const auto& resource = resource_composition.template get_resource_component<
+                Traits::template resource_type_index<ComponentIndex>>(
+                Traits::template resource_index<ComponentIndex>);
+            auto* function = static_cast<FunctionType*>(resource.get_feasibility_function());
+
+            // qualified call: no virtual dispatch
+            return function->FunctionType::is_feasible(resource);
+        }
+};
+}  // namespace rcspp
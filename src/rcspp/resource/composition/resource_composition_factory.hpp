@@ -195,7 +195,7 @@ class ResourceCompositionFactory : public ResourceFactory<ResourceComposition<Re
                 for (int i = 0; i < res_fac_vec.size(); i++) {
                     const auto& res_fac = res_fac_vec[i];
 
-                    prot_res_comp_vec.emplace_back(res_fac->make_resource());
+                    prot_res_comp_vec.push_back(std::move(*res_fac->make_resource()));
                 }
             };
 
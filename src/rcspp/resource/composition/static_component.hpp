@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <typeinfo>
+#include <vector>
+
+#include "rcspp/resource/composition/resource_composition.hpp"
+#include "rcspp/resource/resource_traits.hpp"
+
+namespace rcspp {
+
+/**
+ * @brief Concrete function types of a component of a resource composition.
+ *
+ * The static composition functions (e.g., StaticCompositionExtensionFunction) take the list of the
+ * components of the composition, in the order in which they are added to the graph. They call the
+ * functions of each component without virtual dispatch, so that the compiler can inline the
+ * extension, feasibility, cost and dominance of all the components in a single function.
+ */
+template <typename ComponentResourceType, typename ComponentExtensionFunctionType,
+          typename ComponentFeasibilityFunctionType, typename ComponentCostFunctionType,
+          typename ComponentDominanceFunctionType>
+struct StaticComponent {
+        using ResourceType = ComponentResourceType;
+        using ExtensionFunctionType = ComponentExtensionFunctionType;
+        using FeasibilityFunctionType = ComponentFeasibilityFunctionType;
+        using CostFunctionType = ComponentCostFunctionType;
+        using DominanceFunctionType = ComponentDominanceFunctionType;
+};
+
+// Tag used to select the static composition functions (see ResourceGraph).
+template <typename... ComponentTypes>
+struct StaticComponents {};
+
+// Runtime description of a static component, used to check the functions added to the graph.
+struct StaticComponentInfo {
+        size_t resource_type_index;
+        const std::type_info* extension_function;
+        const std::type_info* feasibility_function;
+        const std::type_info* cost_function;
+        const std::type_info* dominance_function;
+};
+
+template <typename CompositionType, typename... ComponentTypes>
+struct StaticComponentTraits;
+
+template <typename... ResourceTypes, typename... ComponentTypes>
+struct StaticComponentTraits<ResourceComposition<ResourceTypes...>, ComponentTypes...> {
+        template <size_t ComponentIndex>
+        using Component = std::tuple_element_t<ComponentIndex, std::tuple<ComponentTypes...>>;
+
+        // Index of the type of the resource of a component in ResourceTypes.
+        template <size_t ComponentIndex>
+        static constexpr size_t resource_type_index =
+            ResourceTypeIndex_v<typename Component<ComponentIndex>::ResourceType,
+                                ResourceTypes...>;
+
+        // Index of a component in the vector of the components of the same resource type.
+        template <size_t ComponentIndex>
+        static constexpr size_t resource_index = [] {
+            constexpr std::array<size_t, sizeof...(ComponentTypes)> type_indices = {
+                ResourceTypeIndex_v<typename ComponentTypes::ResourceType, ResourceTypes...>...};
+            size_t index = 0;
+            for (size_t i = 0; i < ComponentIndex; ++i) {
+                if (type_indices[i] == type_indices[ComponentIndex]) {
+                    ++index;
+                }
+            }
+            return index;
+        }();
+
+        // Index of the first component of a resource type (or the number of components if none).
+        static constexpr size_t first_component_index(size_t type_index) {
+            constexpr std::array<size_t, sizeof...(ComponentTypes)> type_indices = {
+                ResourceTypeIndex_v<typename ComponentTypes::ResourceType, ResourceTypes...>...};
+            for (size_t i = 0; i < type_indices.size(); ++i) {
+                if (type_indices[i] == type_index) {
+                    return i;
+                }
+            }
+            return type_indices.size();
+        }
+
+        static auto get_infos() -> std::vector<StaticComponentInfo> {
+            return {StaticComponentInfo{
+                ResourceTypeIndex_v<typename ComponentTypes::ResourceType, ResourceTypes...>,
+                &typeid(typename ComponentTypes::ExtensionFunctionType),
+                &typeid(typename ComponentTypes::FeasibilityFunctionType),
+                &typeid(typename ComponentTypes::CostFunctionType),
+                &typeid(typename ComponentTypes::DominanceFunctionType)}...};
+        }
+};
+}  // namespace rcspp
@@ -0,0 +1,290 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>  // NOLINT
+
+// AVX2/AVX-512 kernels, compiled with target attributes and selected at runtime (GCC and Clang on
+// x86-64). Define RCSPP_NO_SIMD to only use the scalar kernels.
+#if !defined(RCSPP_NO_SIMD) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define RCSPP_BITSET_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace rcspp::bitset_kernels {
+
+/**
+ * @brief Word-level operations on the bitsets of BitsetResource (64 bits by word).
+ *
+ * Each operation has a scalar kernel and, on x86-64, AVX2 and AVX-512 kernels. The best kernel
+ * supported by the CPU is selected once at runtime. The bitsets shorter than MIN_SIMD_WORDS words
+ * (e.g., small ng-neighborhoods) always use the scalar kernels, which are faster than a dispatch.
+ */
+enum class SimdLevel : uint8_t { Scalar, Avx2, Avx512 };
+
+inline constexpr size_t MIN_SIMD_WORDS = 4;
+
+// Scalar kernels ---------------------------------------------------------------------------------
+
+// Whether b & ~a is empty on the first n words.
+inline bool includes_scalar(const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if ((b[i] & ~a[i]) != 0ULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Whether a & b is not empty on the first n words.
+inline bool intersects_scalar(const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if ((a[i] & b[i]) != 0ULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// dst |= src on the first n words.
+inline void or_into_scalar(uint64_t* dst, const uint64_t* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] |= src[i];
+    }
+}
+
+// dst &= src on the first n words.
+inline void and_into_scalar(uint64_t* dst, const uint64_t* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] &= src[i];
+    }
+}
+
+#ifdef RCSPP_BITSET_SIMD
+
+// AVX2 kernels (4 words by iteration) ------------------------------------------------------------
+
+__attribute__((target("avx2"))) inline bool includes_avx2(const uint64_t* a, const uint64_t* b,
+                                                           size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));  // NOLINT
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));  // NOLINT
+        // testc is 1 iff vb & ~va is empty
+        if (_mm256_testc_si256(va, vb) == 0) {
+            return false;
+        }
+    }
+    return includes_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline bool intersects_avx2(const uint64_t* a, const uint64_t* b,
+                                                             size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));  // NOLINT
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));  // NOLINT
+        if (_mm256_testz_si256(va, vb) == 0) {
+            return true;
+        }
+    }
+    return intersects_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void or_into_avx2(uint64_t* dst, const uint64_t* src,
+                                                          size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        auto* d = reinterpret_cast<__m256i*>(dst + i);                                    // NOLINT
+        const __m256i vs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));  // NOLINT
+        _mm256_storeu_si256(d, _mm256_or_si256(_mm256_loadu_si256(d), vs));
+    }
+    or_into_scalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void and_into_avx2(uint64_t* dst, const uint64_t* src,
+                                                           size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        auto* d = reinterpret_cast<__m256i*>(dst + i);                                    // NOLINT
+        const __m256i vs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));  // NOLINT
+        _mm256_storeu_si256(d, _mm256_and_si256(_mm256_loadu_si256(d), vs));
+    }
+    and_into_scalar(dst + i, src + i, n - i);
+}
+
+// AVX-512 kernels (8 words by iteration, masked loads and stores on the last words) --------------
+
+// Mask of the first num_words (< 8) words of a vector.
+inline __mmask8 tail_mask(size_t num_words) {
+    return static_cast<__mmask8>((1U << num_words) - 1U);
+}
+
+__attribute__((target("avx512f"))) inline bool includes_avx512(const uint64_t* a,
+                                                                const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i va = _mm512_loadu_si512(a + i);
+        const __m512i vb = _mm512_loadu_si512(b + i);
+        // b is included in a iff a & b == b
+        if (_mm512_cmpneq_epi64_mask(_mm512_and_si512(va, vb), vb) != 0) {
+            return false;
+        }
+    }
+    if (i < n) {
+        const __mmask8 mask = tail_mask(n - i);
+        const __m512i va = _mm512_maskz_loadu_epi64(mask, a + i);
+        const __m512i vb = _mm512_maskz_loadu_epi64(mask, b + i);
+        return _mm512_cmpneq_epi64_mask(_mm512_and_si512(va, vb), vb) == 0;
+    }
+    return true;
+}
+
+__attribute__((target("avx512f"))) inline bool intersects_avx512(const uint64_t* a,
+                                                                  const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        if (_mm512_test_epi64_mask(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)) != 0) {
+            return true;
+        }
+    }
+    if (i < n) {
+        const __mmask8 mask = tail_mask(n - i);
+        return _mm512_test_epi64_mask(_mm512_maskz_loadu_epi64(mask, a + i),
+                                      _mm512_maskz_loadu_epi64(mask, b + i)) != 0;
+    }
+    return false;
+}
+
+__attribute__((target("avx512f"))) inline void or_into_avx512(uint64_t* dst, const uint64_t* src,
+                                                               size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_si512(dst + i,
+                            _mm512_or_si512(_mm512_loadu_si512(dst + i),
+                                            _mm512_loadu_si512(src + i)));
+    }
+    if (i < n) {
+        const __mmask8 mask = tail_mask(n - i);
+        _mm512_mask_storeu_epi64(dst + i,
+                                 mask,
+                                 _mm512_or_si512(_mm512_maskz_loadu_epi64(mask, dst + i),
+                                                 _mm512_maskz_loadu_epi64(mask, src + i)));
+    }
+}
+
+__attribute__((target("avx512f"))) inline void and_into_avx512(uint64_t* dst,
+                                                                const uint64_t* src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_si512(dst + i,
+                            _mm512_and_si512(_mm512_loadu_si512(dst + i),
+                                             _mm512_loadu_si512(src + i)));
+    }
+    if (i < n) {
+        const __mmask8 mask = tail_mask(n - i);
+        _mm512_mask_storeu_epi64(dst + i,
+                                 mask,
+                                 _mm512_and_si512(_mm512_maskz_loadu_epi64(mask, dst + i),
+                                                  _mm512_maskz_loadu_epi64(mask, src + i)));
+    }
+}
+
+#endif  // RCSPP_BITSET_SIMD
+
+// Dispatch ---------------------------------------------------------------------------------------
+
+// Best kernels supported by the CPU (detected once).
+inline SimdLevel get_simd_level() {
+#ifdef RCSPP_BITSET_SIMD
+    static const SimdLevel level = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") != 0) {
+            return SimdLevel::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2") != 0) {
+            return SimdLevel::Avx2;
+        }
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// Whether b & ~a is empty on the first n words (i.e., a includes b).
+inline bool includes(const uint64_t* a, const uint64_t* b, size_t n) {
+#ifdef RCSPP_BITSET_SIMD
+    if (n >= MIN_SIMD_WORDS) {
+        switch (get_simd_level()) {
+            case SimdLevel::Avx512:
+                return includes_avx512(a, b, n);
+            case SimdLevel::Avx2:
+                return includes_avx2(a, b, n);
+            case SimdLevel::Scalar:
+                break;
+        }
+    }
+#endif
+    return includes_scalar(a, b, n);
+}
+
+// Whether a & b is not empty on the first n words.
+inline bool intersects(const uint64_t* a, const uint64_t* b, size_t n) {
+#ifdef RCSPP_BITSET_SIMD
+    if (n >= MIN_SIMD_WORDS) {
+        switch (get_simd_level()) {
+            case SimdLevel::Avx512:
+                return intersects_avx512(a, b, n);
+            case SimdLevel::Avx2:
+                return intersects_avx2(a, b, n);
+            case SimdLevel::Scalar:
+                break;
+        }
+    }
+#endif
+    return intersects_scalar(a, b, n);
+}
+
+// dst |= src on the first n words.
+inline void or_into(uint64_t* dst, const uint64_t* src, size_t n) {
+#ifdef RCSPP_BITSET_SIMD
+    if (n >= MIN_SIMD_WORDS) {
+        switch (get_simd_level()) {
+            case SimdLevel::Avx512:
+                or_into_avx512(dst, src, n);
+                return;
+            case SimdLevel::Avx2:
+                or_into_avx2(dst, src, n);
+                return;
+            case SimdLevel::Scalar:
+                break;
+        }
+    }
+#endif
+    or_into_scalar(dst, src, n);
+}
+
+// dst &= src on the first n words.
+inline void and_into(uint64_t* dst, const uint64_t* src, size_t n) {
+#ifdef RCSPP_BITSET_SIMD
+    if (n >= MIN_SIMD_WORDS) {
+        switch (get_simd_level()) {
+            case SimdLevel::Avx512:
+                and_into_avx512(dst, src, n);
+                return;
+            case SimdLevel::Avx2:
+                and_into_avx2(dst, src, n);
+                return;
+            case SimdLevel::Scalar:
+                break;
+        }
+    }
+#endif
+    and_into_scalar(dst, src, n);
+}
+
+}  // namespace rcspp::bitset_kernels
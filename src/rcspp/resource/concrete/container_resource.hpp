@@ -4,15 +4,22 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <bit>      // NOLINT
+#include <cstddef>
 #include <cstdint>  // NOLINT
+#include <functional>
 #include <iterator>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "rcspp/resource/base/resource_base.hpp"
+#include "rcspp/resource/concrete/bitset_kernels.hpp"
+#include "rcspp/utils/logger.hpp"
 
 namespace rcspp {
 
@@ -40,13 +47,49 @@ class ContainerResource : public ResourceBase<DerivedType> {
         [[nodiscard]] virtual bool intersects(const Container& /*other*/) const = 0;
         [[nodiscard]] virtual Container get_union(const Container& /*other*/) const = 0;
         [[nodiscard]] virtual Container get_intersection(const Container& /*other*/) const = 0;
+        // In-place intersection (the in-place union is add(container)).
+        virtual void intersect_with(const Container& /*other*/) = 0;
+
+        // Set the value to lhs | rhs (resp. lhs & rhs), reusing the storage of this container
+        // instead of building a new one as get_union (resp. get_intersection) does. lhs or rhs can
+        // be the value of this resource.
+        void assign_union(const Container& lhs, const Container& rhs) {
+            add(assign_one_of(lhs, rhs));
+        }
+
+        void assign_intersection(const Container& lhs, const Container& rhs) {
+            intersect_with(assign_one_of(lhs, rhs));
+        }
+
+        // 64-bit fingerprint of the values: the fingerprint of a subset is included in the
+        // fingerprint of the set (see DominanceSignature).
+        [[nodiscard]] virtual uint64_t get_fingerprint() const = 0;
 
         [[nodiscard]] virtual size_t size() const { return container_.size(); }
 
-        void reset() override { this->container_.clear(); }
+        void reset() override {
+            if constexpr (requires { this->container_.clear(); }) {
+                this->container_.clear();
+            } else {
+                this->container_ = Container{};
+            }
+        }
 
     protected:
-        Container container_;
+        Container container_{};
+
+    private:
+        // Copy one of the operands into this container (none if one of them is this container)
+        // and return the other one.
+        const Container& assign_one_of(const Container& lhs, const Container& rhs) {
+            if (&rhs == &container_) {
+                return lhs;
+            }
+            if (&lhs != &container_) {
+                container_ = lhs;
+            }
+            return rhs;
+        }
 };
 
 // Partial specialization for std::set<T>
@@ -120,6 +163,28 @@ class SetResource : public ContainerResource<std::set<T>, SetResource<T>, T> {
                                   std::inserter(result, result.begin()));
             return result;
         }
+
+        [[nodiscard]] uint64_t get_fingerprint() const override {
+            uint64_t fingerprint = 0;
+            for (const auto& value : this->container_) {
+                fingerprint |= 1ULL << (std::hash<T>{}(value) & 63);  // NOLINT
+            }
+            return fingerprint;
+        }
+
+        void intersect_with(const Container& other_set) override {
+            auto it_other = other_set.begin();
+            for (auto it = this->container_.begin(); it != this->container_.end();) {
+                while (it_other != other_set.end() && *it_other < *it) {
+                    ++it_other;
+                }
+                if (it_other == other_set.end() || *it < *it_other) {
+                    it = this->container_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
 };
 
 // Proper bitset specialization: implement bitset semantics using word vector
@@ -159,13 +224,22 @@ class BitsetResource : public ContainerResource<std::vector<uint64_t>, BitsetRes
             this->container_[idx >> 6] |= (1ULL << (idx & 63));  // NOLINT
         }
 
+        // In-place union (no allocation if this bitset has at least as many words).
         void add(const Container& other_words) override {
             // OR the other words into this bitset
             const size_t other_words_count = other_words.size();
             ensure_size(other_words_count * 64);  // NOLINT
-            for (size_t i = 0; i < other_words_count; ++i) {
-                this->container_[i] |= other_words[i];
+            bitset_kernels::or_into(this->container_.data(), other_words.data(), other_words_count);
+        }
+
+        // In-place intersection (never allocates): same words as get_intersection.
+        void intersect_with(const Container& other_words) override {
+            if (this->container_.size() > other_words.size()) {
+                this->container_.resize(other_words.size());
             }
+            bitset_kernels::and_into(this->container_.data(),
+                                     other_words.data(),
+                                     this->container_.size());
         }
 
         void remove(const ValueType& idx) override {
@@ -184,43 +258,45 @@ class BitsetResource : public ContainerResource<std::vector<uint64_t>, BitsetRes
         [[nodiscard]] bool includes(const Container& other) const override {
             const size_t words_this = this->container_.size();
             const size_t words_other = other.size();
-            for (size_t i = 0; i < words_other; ++i) {
-                const uint64_t ow = other[i];
-                const uint64_t tw = (i < words_this) ? this->container_[i] : 0ULL;
-                if ((ow & ~tw) != 0ULL) {
-                    return false;
-                }
+            if (!bitset_kernels::includes(
+                    this->container_.data(), other.data(), std::min(words_this, words_other))) {
+                return false;
             }
-            return true;
+            // the words of other beyond this bitset must be empty
+            return std::all_of(other.begin() + static_cast<std::ptrdiff_t>(
+                                                   std::min(words_this, words_other)),
+                               other.end(),
+                               [](uint64_t word) { return word == 0ULL; });
         }
 
         [[nodiscard]] bool intersects(const Container& other) const override {
-            const size_t words = std::min(this->container_.size(), other.size());
-            for (size_t i = 0; i < words; ++i) {
-                if ((this->container_[i] & other[i]) != 0ULL) {
-                    return true;
-                }
+            return bitset_kernels::intersects(this->container_.data(),
+                                              other.data(),
+                                              std::min(this->container_.size(), other.size()));
+        }
+
+        // OR of the words: bit i is set iff a value equal to i modulo 64 is in the bitset.
+        [[nodiscard]] uint64_t get_fingerprint() const override {
+            uint64_t fingerprint = 0;
+            for (const uint64_t w : this->container_) {
+                fingerprint |= w;
             }
-            return false;
+            return fingerprint;
         }
 
         [[nodiscard]] Container get_union(const Container& other) const override {
-            const size_t words_max = std::max(this->container_.size(), other.size());
-            Container out(words_max, 0ULL);
-            for (size_t i = 0; i < words_max; ++i) {
-                const uint64_t a = (i < this->container_.size()) ? this->container_[i] : 0ULL;
-                const uint64_t b = (i < other.size()) ? other[i] : 0ULL;
-                out[i] = a | b;
-            }
+            const bool this_longer = this->container_.size() >= other.size();
+            Container out = this_longer ? this->container_ : other;
+            const Container& shorter = this_longer ? other : this->container_;
+            bitset_kernels::or_into(out.data(), shorter.data(), shorter.size());
             return out;
         }
 
         [[nodiscard]] Container get_intersection(const Container& other) const override {
             const size_t words_min = std::min(this->container_.size(), other.size());
-            Container out(words_min, 0ULL);
-            for (size_t i = 0; i < words_min; ++i) {
-                out[i] = this->container_[i] & other[i];
-            }
+            Container out(this->container_.begin(),
+                          this->container_.begin() + static_cast<std::ptrdiff_t>(words_min));
+            bitset_kernels::and_into(out.data(), other.data(), words_min);
             // keep trailing zero words for intersection to avoid resizing issues
             // // remove trailing zero words
             // while (!out.empty() && out.back() == 0ULL) {
@@ -258,4 +334,107 @@ class BitsetResource : public ContainerResource<std::vector<uint64_t>, BitsetRes
         }
 };
 
+// Bitset with a capacity of N values (0 to N-1) fixed at compile time: the words are stored inline
+// in the resource (no heap allocation when copying, extending or resetting it), and all the
+// operations work on the NUM_WORDS words. Use it instead of BitsetResource when the number of nodes
+// is known when writing the resource types (e.g., the ng-path resource of a VRP).
+template <size_t N, typename T = size_t>
+class FixedBitsetResource
+    : public ContainerResource<std::array<uint64_t, (N + 63) / 64>, FixedBitsetResource<N, T>, T> {
+    public:
+        static constexpr size_t NUM_WORDS = (N + 63) / 64;
+        using Container = std::array<uint64_t, NUM_WORDS>;
+        using ValueType = T;
+        using Derived = FixedBitsetResource<N, T>;
+
+        FixedBitsetResource() = default;
+        explicit FixedBitsetResource(const std::set<ValueType>& indices) { set_value(indices); }
+
+        // convenience setter from an index set
+        // -> necessary for an initializer with a set (i.e. ResourceInitializerTypeTuple)
+        void set_value(const std::set<ValueType>& indices) {
+            this->container_.fill(0ULL);
+            for (auto idx : indices) {
+                add(idx);
+            }
+        }
+
+        void set_value(Container container) override { this->container_ = container; }
+
+        void add(const ValueType& idx) override {
+            if (static_cast<size_t>(idx) >= N) {
+                LOG_FATAL("FixedBitsetResource::add: value ", idx, " is out of the capacity ", N,
+                          ".\n");
+                throw std::out_of_range("FixedBitsetResource::add: value " + std::to_string(idx) +
+                                        " is out of the capacity " + std::to_string(N) + ".");
+            }
+            this->container_[idx >> 6] |= (1ULL << (idx & 63));  // NOLINT
+        }
+
+        // In-place union.
+        void add(const Container& other_words) override {
+            bitset_kernels::or_into(this->container_.data(), other_words.data(), NUM_WORDS);
+        }
+
+        // In-place intersection.
+        void intersect_with(const Container& other_words) override {
+            bitset_kernels::and_into(this->container_.data(), other_words.data(), NUM_WORDS);
+        }
+
+        void remove(const ValueType& idx) override {
+            if (static_cast<size_t>(idx) < N) {
+                this->container_[idx >> 6] &= ~(1ULL << (idx & 63));  // NOLINT
+            }
+        }
+
+        [[nodiscard]] bool contains(const ValueType& idx) const override {
+            if (static_cast<size_t>(idx) >= N) {
+                return false;
+            }
+            return ((this->container_[idx >> 6] >> (idx & 63)) & 1ULL) != 0ULL;  // NOLINT
+        }
+
+        [[nodiscard]] bool includes(const Container& other) const override {
+            return bitset_kernels::includes(this->container_.data(), other.data(), NUM_WORDS);
+        }
+
+        [[nodiscard]] bool intersects(const Container& other) const override {
+            return bitset_kernels::intersects(this->container_.data(), other.data(), NUM_WORDS);
+        }
+
+        // OR of the words: bit i is set iff a value equal to i modulo 64 is in the bitset.
+        [[nodiscard]] uint64_t get_fingerprint() const override {
+            uint64_t fingerprint = 0;
+            for (const uint64_t w : this->container_) {
+                fingerprint |= w;
+            }
+            return fingerprint;
+        }
+
+        [[nodiscard]] Container get_union(const Container& other) const override {
+            Container out = this->container_;
+            bitset_kernels::or_into(out.data(), other.data(), NUM_WORDS);
+            return out;
+        }
+
+        [[nodiscard]] Container get_intersection(const Container& other) const override {
+            Container out = this->container_;
+            bitset_kernels::and_into(out.data(), other.data(), NUM_WORDS);
+            return out;
+        }
+
+        // Number of values in the bitset (not the number of words, which is NUM_WORDS).
+        [[nodiscard]] size_t size() const override {
+            size_t count = 0;
+            for (const uint64_t w : this->container_) {
+                count += static_cast<size_t>(std::popcount(w));
+            }
+            return count;
+        }
+
+        void reset() override { this->container_.fill(0ULL); }
+
+        [[nodiscard]] const Container& words() const { return this->container_; }
+};
+
 }  // namespace rcspp
@@ -17,5 +17,12 @@ class InclusionDominanceFunction
             // lhs_resource dominates rhs_resource if lhs_resource <= rhs_resource
             return rhs_resource.includes(lhs_resource.get_value());
         }
+
+        void add_to_signature(const Resource<ResourceType>& resource,
+                              DominanceSignature* signature) override {
+            // the fingerprints do not decide the inclusion
+            signature->add_fingerprint(resource.get_fingerprint());
+            signature->exact = false;
+        }
 };
 }  // namespace rcspp
@@ -23,5 +23,18 @@ class ValueDominanceFunction
                              const Resource<ResourceType>& rhs_resource) -> bool override {
             return lhs_resource.leq(rhs_resource.get_value());
         }
+
+        // The value is a key (when it converts to a double without breaking the order nor the
+        // tolerance of value_leq), which decides the dominance if the conversion is exact.
+        void add_to_signature(const Resource<ResourceType>& resource,
+                              DominanceSignature* signature) override {
+            if constexpr (std::is_same_v<ValueType, double> || std::is_integral_v<ValueType>) {
+                signature->add_key(static_cast<double>(resource.get_value()));
+            }
+            if constexpr (!std::is_same_v<ValueType, double> &&
+                          !(std::is_integral_v<ValueType> && sizeof(ValueType) <= 4)) {
+                signature->exact = false;
+            }
+        }
 };
 }  // namespace rcspp
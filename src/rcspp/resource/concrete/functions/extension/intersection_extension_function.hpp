@@ -15,8 +15,7 @@ class IntersectionExtensionFunction : public Clonable<IntersectionExtensionFunct
     public:
         void extend(const Resource<ResourceType>& resource, const Extender<ResourceType>& extender,
                     Resource<ResourceType>* extended_resource) override {
-            auto intersection_container = resource.get_intersection(extender.get_value());
-            extended_resource->set_value(intersection_container);
+            extended_resource->assign_intersection(resource.get_value(), extender.get_value());
         }
 };
 }  // namespace rcspp
@@ -25,10 +25,11 @@ class NgPathExtensionFunction : public Clonable<NgPathExtensionFunction<Resource
         void extend(const Resource<ResourceType>& resource, const Extender<ResourceType>& extender,
                     Resource<ResourceType>* extended_resource) override {
             // keep only the nodes in the neighborhood of the origin node of the arc
-            auto intersection_container = resource.get_intersection(ng_neighborhood_.get_value());
+            // (in place, in the storage of the extended resource)
+            extended_resource->assign_intersection(resource.get_value(),
+                                                   ng_neighborhood_.get_value());
             // then, add the extender value (which is the origin node of the arc normally)
-            intersection_container = extender.get_union(intersection_container);
-            extended_resource->set_value(intersection_container);
+            extended_resource->add(extender.get_value());
         }
 
     private:
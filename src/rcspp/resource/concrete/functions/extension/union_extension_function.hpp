@@ -15,8 +15,7 @@ class UnionExtensionFunction
     public:
         void extend(const Resource<ResourceType>& resource, const Extender<ResourceType>& extender,
                     Resource<ResourceType>* extended_resource) override {
-            auto union_container = resource.get_union(extender.get_value());
-            extended_resource->set_value(union_container);
+            extended_resource->assign_union(resource.get_value(), extender.get_value());
         }
 };
 }  // namespace rcspp
@@ -6,6 +6,8 @@
 #include <memory>
 #include <utility>
 
+#include "rcspp/resource/functions/dominance/dominance_signature.hpp"
+
 namespace rcspp {
 
 template <typename ResourceType>
@@ -19,6 +21,15 @@ class DominanceFunction {
         virtual auto check_dominance(const Resource<ResourceType>& lhs_resource,
                                      const Resource<ResourceType>& rhs_resource) -> bool = 0;
 
+        // Add the keys and fingerprint of the resource to its signature. The signatures must be
+        // consistent with check_dominance (see DominanceSignature::may_dominate), and remain exact
+        // only if check_dominance is decided by the keys. By default, nothing is added: the
+        // resources are only compared with check_dominance.
+        virtual void add_to_signature(const Resource<ResourceType>& /*resource*/,
+                                      DominanceSignature* signature) {
+            signature->exact = false;
+        }
+
         [[nodiscard]] virtual auto clone() const -> std::unique_ptr<DominanceFunction> = 0;
 
         auto create(const size_t node_id) -> std::unique_ptr<DominanceFunction> {
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Laboratory for Combinatorial Optimization in Real-time Environment.
+// All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>  // NOLINT
+
+#include "rcspp/resource/concrete/numerical_resource.hpp"
+
+namespace rcspp {
+
+/**
+ * @brief Compact summary of a resource used to reject most non-dominance cases before the full
+ * dominance check (see DominanceFunction::add_to_signature).
+ *
+ * The signature holds a few numerical keys, which must be lower or equal in a dominating resource
+ * (e.g., the values of the components with a ValueDominanceFunction), and a 64-bit Bloom-style
+ * fingerprint of the sets, which must be included in the one of the dominated resource (e.g., the
+ * components with an InclusionDominanceFunction). The test is conservative: may_dominate is true
+ * whenever the full dominance check can be true, and always true for an invalid signature.
+ *
+ * A signature is exact if its keys alone decide the dominance (e.g., a composition of numerical
+ * resources which all have a ValueDominanceFunction): the full dominance check between two exact
+ * signatures with the same keys is then equivalent to may_dominate (see decides).
+ */
+struct DominanceSignature {
+        static constexpr size_t MAX_KEYS = 4;
+
+        std::array<double, MAX_KEYS> keys{};
+        uint64_t fingerprint = 0;
+        uint8_t num_keys = 0;
+        bool valid = false;
+        bool exact = false;
+
+        // Add a key (ignored once MAX_KEYS keys have been added, the signature is then inexact).
+        void add_key(double key) {
+            if (num_keys < MAX_KEYS) {
+                keys[num_keys++] = key;
+            } else {
+                exact = false;
+            }
+        }
+
+        void add_fingerprint(uint64_t set_fingerprint) { fingerprint |= set_fingerprint; }
+
+        // Whether a resource with this signature can dominate a resource with the other signature.
+        [[nodiscard]] bool may_dominate(const DominanceSignature& other) const {
+            if (!valid || !other.valid) {
+                return true;
+            }
+            if ((fingerprint & ~other.fingerprint) != 0ULL) {
+                return false;
+            }
+            const size_t n = std::min(num_keys, other.num_keys);
+            for (size_t i = 0; i < n; ++i) {
+                if (!value_leq(keys[i], other.keys[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Whether may_dominate(other) is the result of the full dominance check.
+        [[nodiscard]] bool decides(const DominanceSignature& other) const {
+            return valid && other.valid && exact && other.exact && num_keys == other.num_keys;
+        }
+};
+}  // namespace rcspp
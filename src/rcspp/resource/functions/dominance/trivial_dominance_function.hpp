@@ -16,5 +16,9 @@ class TrivialDominanceFunction
                              const Resource<ResourceType>& rhs_resource) override {
             return true;
         }
+
+        // Always dominates: the signature remains exact.
+        void add_to_signature(const Resource<ResourceType>& /*resource*/,
+                              DominanceSignature* /*signature*/) override {}
 };
 }  // namespace rcspp
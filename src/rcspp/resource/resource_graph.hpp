@@ -4,10 +4,18 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
 #include <limits>
 #include <memory>
 #include <mutex>  // NOLINT
+#include <shared_mutex>  // NOLINT
+#include <stdexcept>
+#include <thread>  // NOLINT
 #include <tuple>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -19,8 +27,13 @@
 #include "rcspp/preprocessor/shortest_path_connectivity_sort.hpp"
 #include "rcspp/preprocessor/shortest_path_preprocessor.hpp"
 #include "rcspp/resource/composition/functions/cost/component_cost_function.hpp"
+#include "rcspp/resource/composition/functions/cost/static_component_cost_function.hpp"
+#include "rcspp/resource/composition/functions/dominance/static_composition_dominance_function.hpp"
+#include "rcspp/resource/composition/functions/extension/static_composition_extension_function.hpp"
+#include "rcspp/resource/composition/functions/feasibility/static_composition_feasibility_function.hpp"
 #include "rcspp/resource/composition/resource_composition.hpp"
 #include "rcspp/resource/composition/resource_composition_factory.hpp"
+#include "rcspp/resource/composition/static_component.hpp"
 #include "rcspp/resource/concrete/numerical_resource.hpp"
 #include "rcspp/resource/resource_traits.hpp"
 
@@ -50,6 +63,25 @@ class ResourceGraph : public Graph<ResourceComposition<ResourceTypes...>> {
                   std::make_unique<CompositionDominanceFunction<ResourceTypes...>>())),
               connectivityMatrix_(this) {}
 
+        // Use the static composition functions, which call the functions of the components without
+        // virtual dispatch. The resources must then be added with functions of the types given by
+        // ComponentTypes (see StaticComponent), in the same order for each resource type. The cost
+        // is the cost of the first component of the first resource type.
+        template <typename... ComponentTypes>
+        explicit ResourceGraph(StaticComponents<ComponentTypes...> /*unused*/)
+            : resource_factory_(ResourceCompositionFactory<ResourceTypes...>(
+                  std::make_unique<StaticCompositionExtensionFunction<
+                      ResourceComposition<ResourceTypes...>, ComponentTypes...>>(),
+                  std::make_unique<StaticCompositionFeasibilityFunction<
+                      ResourceComposition<ResourceTypes...>, ComponentTypes...>>(),
+                  make_static_cost_function<ComponentTypes...>(),
+                  std::make_unique<StaticCompositionDominanceFunction<
+                      ResourceComposition<ResourceTypes...>, ComponentTypes...>>())),
+              connectivityMatrix_(this),
+              static_components_(
+                  StaticComponentTraits<ResourceComposition<ResourceTypes...>,
+                                        ComponentTypes...>::get_infos()) {}
+
         ResourceGraph(const ResourceGraph&) = delete;
         ResourceGraph& operator=(const ResourceGraph&) = delete;
         ResourceGraph(ResourceGraph&&) = delete;
@@ -64,6 +96,16 @@ class ResourceGraph : public Graph<ResourceComposition<ResourceTypes...>> {
                 ResourceTypeIndex_v<ResourceType, ResourceTypes...>;
             using ResourceFactoryType = ResourceFactory<ResourceType>;
 
+            const size_t resource_index = num_components_by_type_[ResourceTypeIndex]++;
+            if (!static_components_.empty()) {
+                check_static_component(ResourceTypeIndex,
+                                       resource_index,
+                                       *extension_function,
+                                       *feasibility_function,
+                                       *cost_function,
+                                       *dominance_function);
+            }
+
             resource_factory_.template add_resource_factory<ResourceTypeIndex, ResourceType>(
                 std::make_unique<ResourceFactoryType>(std::move(extension_function),
                                                       std::move(feasibility_function),
@@ -195,67 +237,103 @@ class ResourceGraph : public Graph<ResourceComposition<ResourceTypes...>> {
             return solve(&algorithm, upper_bound, preprocess, cost_index);
         }
 
+        // Several solves can run concurrently on the same graph (e.g., with different upper bounds
+        // or parameters), each with its own algorithm. The arcs removed by the preprocessing are
+        // only skipped by the algorithm of the solve (see ArcMask). The graph must not be modified
+        // (e.g., update_reduced_costs) while solving.
         template <typename CostResourceType = RealResource, template <typename> class AlgorithmType>
         std::vector<Solution> solve(AlgorithmType<ResourceComposition<ResourceTypes...>>* algorithm,
                                     double upper_bound = std::numeric_limits<double>::infinity(),
                                     bool preprocess = true, int cost_index = 0) {
-            if (this->get_source_node_ids().empty() || this->get_sink_node_ids().empty()) {
-                LOG_WARN("ResourceGraph::solve: No source or sink nodes defined in the graph.");
+            if (!check_solve()) {
                 return {};
             }
 
-            // try to acquire the mutex without blocking
-            std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
-            if (!lock.owns_lock()) {
-                LOG_WARN(
-                    "ResourceGraph::solve: Cannot lock the mutex. Concurrent solves are not "
-                    "allowed.");
-                return {};
-            }
+            prepare_solve(preprocess);
 
-            std::vector<std::unique_ptr<Preprocessor<ResourceComposition<ResourceTypes...>>>>
-                preprocessors;
-            if (preprocess) {
-                // if graph has been modified, try to remove some arcs based on feasibility
-                // initialize or update connectivity matrix
-                if (this->is_modified()) {
-                    process_feasibility();
-                    connectivityMatrix_.compute_bitmatrix();
-                }
+            // read-only from here: the graph must not be modified by another thread while solving
+            std::shared_lock<std::shared_mutex> lock(mutex_);
 
-                // if not sorted, use default sort by connectivity
-                if (!this->are_nodes_sorted()) {
-                    this->sort_nodes_by_connectivity();
-                }
+            return solve_prepared<CostResourceType>(this,
+                                                    algorithm,
+                                                    upper_bound,
+                                                    preprocess,
+                                                    cost_index);
+        }
 
-                // remove some arcs before solving the problem
-                // the deleted arcs will be restored after the solve
-                auto preprocessor =
-                    std::make_unique<ShortestPathPreprocessor<CostResourceType, ResourceTypes...>>(
-                        this,
-                        upper_bound,
-                        cost_index);
-                preprocessor->preprocess();
-                preprocessors.emplace_back(std::move(preprocessor));
+        /**
+         * @brief Solves the RCSPP for each dual vector of a batch (e.g., the dual points of a
+         * stabilization, or the duals of several vehicle types), in parallel.
+         *
+         * The graph is preprocessed and sorted once for the whole batch. Each thread solves its
+         * dual vectors one after the other, on its own copy of the graph and with its own
+         * algorithm. Before each solve, the thread sets the reduced costs of the dual vector on
+         * its copy (see update_reduced_costs). The reduced costs of this graph are not modified.
+         *
+         * @param num_threads Number of threads (0 = number of hardware threads).
+         * @return The solutions of each dual vector, in the order of the batch.
+         */
+        template <template <typename> class AlgorithmType = SimpleDominanceAlgorithm,
+                  typename CostResourceType = RealResource>
+        std::vector<std::vector<Solution>> solve_batch(
+            const std::vector<std::vector<double>>& duals_batch,
+            double upper_bound = std::numeric_limits<double>::infinity(),
+            AlgorithmParams params = {}, bool preprocess = true, size_t cost_index = 0,
+            size_t num_threads = 0) {
+            std::vector<std::vector<Solution>> solutions_batch(duals_batch.size());
+            if (duals_batch.empty() || !check_solve()) {
+                return solutions_batch;
             }
 
-            // if not sorted, use default sort (by id)
-            if (!this->are_nodes_sorted()) {
-                this->sort_nodes();
-            }
+            prepare_solve(preprocess);
 
-            // solve the rcspp
-            std::vector<Solution> sols = algorithm->solve(this, upper_bound);
+            std::shared_lock<std::shared_mutex> lock(mutex_);
 
-            // restore the removed arcs for the next resolution
-            if (preprocess) {
-                for (auto& preprocessor : preprocessors) {
-                    preprocessor->restore();
+            if (num_threads == 0) {
+                num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+            }
+            num_threads = std::min(num_threads, duals_batch.size());
+
+            std::atomic<size_t> next_index{0};
+            std::mutex exception_mutex;
+            std::exception_ptr exception;
+            auto run_worker = [&]() {
+                try {
+                    auto graph = this->clone();
+                    AlgorithmType<ResourceComposition<ResourceTypes...>> algorithm(
+                        &resource_factory_,
+                        params);
+                    for (size_t i = next_index++; i < duals_batch.size(); i = next_index++) {
+                        update_reduced_costs<CostResourceType>(graph.get(),
+                                                               duals_batch[i],
+                                                               cost_index);
+                        solutions_batch[i] = solve_prepared<CostResourceType>(graph.get(),
+                                                                              &algorithm,
+                                                                              upper_bound,
+                                                                              preprocess,
+                                                                              cost_index);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> exception_lock(exception_mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
                 }
-                this->track_modifications();  // mark as unmodified after restoring arcs
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for (size_t t = 0; t < num_threads; ++t) {
+                threads.emplace_back(run_worker);
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
             }
 
-            return sols;
+            return solutions_batch;
         }
 
         void process_feasibility() {
@@ -276,7 +354,15 @@ class ResourceGraph : public Graph<ResourceComposition<ResourceTypes...>> {
 
         template <typename CostResourceType = RealResource>
         void update_reduced_costs(const std::vector<double>& duals, size_t cost_index = 0) {
-            for (auto& [arc_id, arc_ptr] : this->get_arcs_by_id()) {
+            update_reduced_costs<CostResourceType>(this, duals, cost_index);
+        }
+
+    private:
+        // Set the reduced costs of the arcs of the graph (this graph or a copy of it).
+        template <typename CostResourceType>
+        void update_reduced_costs(Graph<ResourceComposition<ResourceTypes...>>* graph,
+                                  const std::vector<double>& duals, size_t cost_index) {
+            for (auto& [arc_id, arc_ptr] : graph->get_arcs_by_id()) {
                 double reduced_cost = arc_ptr->cost;
                 for (const auto& dual_row : arc_ptr->dual_rows) {
                     const auto dual_value = duals.at(dual_row.index);
@@ -288,9 +374,152 @@ class ResourceGraph : public Graph<ResourceComposition<ResourceTypes...>> {
             }
         }
 
-    private:
+        // Whether the graph can be solved (throw if the resources do not match the static
+        // components).
+        [[nodiscard]] bool check_solve() const {
+            if (this->get_source_node_ids().empty() || this->get_sink_node_ids().empty()) {
+                LOG_WARN("ResourceGraph::solve: No source or sink nodes defined in the graph.");
+                return false;
+            }
+
+            if (!static_components_.empty()) {
+                size_t num_components = 0;
+                for (auto num_components_of_type : num_components_by_type_) {
+                    num_components += num_components_of_type;
+                }
+                if (num_components != static_components_.size()) {
+                    LOG_FATAL("ResourceGraph::solve: ",
+                              num_components,
+                              " resources added for ",
+                              static_components_.size(),
+                              " static components.\n");
+                    throw std::runtime_error(
+                        "ResourceGraph::solve: The resources do not match the static components.");
+                }
+            }
+
+            return true;
+        }
+
+        // The graph is only modified here (feasibility preprocessing and sorting), once for all
+        // the solves, so that several solves can then run concurrently on the graph. The
+        // exclusive lock (which waits for the running solves) is only taken when there is
+        // something to prepare.
+        void prepare_solve(bool preprocess) {
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                if (is_prepared(preprocess)) {
+                    return;
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            // another solve may have prepared the graph in the meantime: the checks below only
+            // modify the graph if it still needs it
+            if (preprocess) {
+                // if graph has been modified, try to remove some arcs based on feasibility
+                // initialize or update connectivity matrix
+                if (this->is_modified()) {
+                    process_feasibility();
+                    connectivityMatrix_.compute_bitmatrix();
+                    this->track_modifications();
+                }
+
+                // if not sorted, use default sort by connectivity
+                if (!this->are_nodes_sorted()) {
+                    this->sort_nodes_by_connectivity();
+                }
+            }
+
+            // if not sorted, use default sort (by id)
+            if (!this->are_nodes_sorted()) {
+                this->sort_nodes();
+            }
+        }
+
+        // Whether prepare_solve has nothing to do.
+        [[nodiscard]] bool is_prepared(bool preprocess) const {
+            return (!preprocess || !this->is_modified()) && this->are_nodes_sorted();
+        }
+
+        // Solve the prepared graph (this graph or a copy of it) without modifying it.
+        template <typename CostResourceType>
+        static std::vector<Solution> solve_prepared(
+            Graph<ResourceComposition<ResourceTypes...>>* graph,
+            Algorithm<ResourceComposition<ResourceTypes...>>* algorithm, double upper_bound,
+            bool preprocess, size_t cost_index) {
+            // lower bounds on the cost to reach a sink, used by the algorithm to prune labels
+            std::unordered_map<size_t, double> completion_bound_by_node_id;
+            // arcs skipped by this solve (instead of being removed from the graph)
+            ArcMask arc_mask;
+            if (preprocess) {
+                ShortestPathPreprocessor<CostResourceType, ResourceTypes...> preprocessor(
+                    graph,
+                    upper_bound,
+                    cost_index);
+                arc_mask = preprocessor.make_arc_mask();
+                completion_bound_by_node_id = preprocessor.get_dist_to_sinks();
+            }
+
+            // solve the rcspp
+            algorithm->set_completion_bounds(std::move(completion_bound_by_node_id));
+            algorithm->set_arc_mask(std::move(arc_mask));
+            return algorithm->solve(graph, upper_bound);
+        }
+
+        template <typename... ComponentTypes>
+        static auto make_static_cost_function()
+            -> std::unique_ptr<CostFunction<ResourceComposition<ResourceTypes...>>> {
+            using Traits =
+                StaticComponentTraits<ResourceComposition<ResourceTypes...>, ComponentTypes...>;
+            constexpr size_t ComponentIndex = Traits::first_component_index(0);
+            static_assert(ComponentIndex < sizeof...(ComponentTypes),
+                          "The static components must include a component of the first resource "
+                          "type (cost).");
+
+            return std::make_unique<StaticComponentCostFunction<
+                0,
+                typename Traits::template Component<ComponentIndex>::CostFunctionType,
+                ResourceTypes...>>(0);
+        }
+
+        // Check that the functions of a resource added to the graph match the static component.
+        void check_static_component(size_t resource_type_index, size_t resource_index,
+                                    const auto& extension_function,
+                                    const auto& feasibility_function, const auto& cost_function,
+                                    const auto& dominance_function) const {
+            size_t index = 0;
+            for (const auto& static_component : static_components_) {
+                if (static_component.resource_type_index != resource_type_index) {
+                    continue;
+                }
+                if (index++ < resource_index) {
+                    continue;
+                }
+                if (*static_component.extension_function == typeid(extension_function) &&
+                    *static_component.feasibility_function == typeid(feasibility_function) &&
+                    *static_component.cost_function == typeid(cost_function) &&
+                    *static_component.dominance_function == typeid(dominance_function)) {
+                    return;
+                }
+                break;
+            }
+
+            LOG_FATAL("ResourceGraph::add_resource: The functions of the resource ",
+                      resource_index,
+                      " of type ",
+                      resource_type_index,
+                      " do not match the static components.\n");
+            throw std::runtime_error(
+                "ResourceGraph::add_resource: The functions do not match the static components.");
+        }
+
         ResourceCompositionFactory<ResourceTypes...> resource_factory_;
         ConnectivityMatrix<ResourceComposition<ResourceTypes...>> connectivityMatrix_;
-        std::mutex mutex_;
+        std::shared_mutex mutex_;
+
+        // empty if the composition functions are not static
+        std::vector<StaticComponentInfo> static_components_;
+        std::array<size_t, sizeof...(ResourceTypes)> num_components_by_type_{};
 };
 }  // namespace rcspp
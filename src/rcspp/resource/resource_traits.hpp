@@ -81,4 +81,15 @@ struct ResourceInitializerTypeTuple<BitsetResource<T>> {
 
 using UIntBitsetResource = BitsetResource<unsigned int>;
 using SizeTBitsetResource = BitsetResource<size_t>;
+
+template <size_t N, typename T>
+class FixedBitsetResource;
+// specialization for FixedBitsetResource<N, T>
+template <size_t N, typename T>
+struct ResourceInitializerTypeTuple<FixedBitsetResource<N, T>> {
+        using type = std::tuple<std::set<T>>;
+};
+
+template <size_t N>
+using SizeTFixedBitsetResource = FixedBitsetResource<N, size_t>;
 }  // namespace rcspp
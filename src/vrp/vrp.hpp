@@ -18,6 +18,19 @@ using RGraph = ResourceGraph<RealResource, IntResource, SizeTSetResource, SizeTB
 using ResourceType =
     ResourceComposition<RealResource, IntResource, SizeTSetResource, SizeTBitsetResource>;
 
+// Functions of the resources added by VRP::construct_resource_graph (distance, time and demand),
+// called without virtual dispatch. To be updated with the resources of the graph.
+using VRPStaticComponents = StaticComponents<
+    StaticComponent<RealResource, AdditionExtensionFunction<RealResource>,
+                    TrivialFeasibilityFunction<RealResource>, ValueCostFunction<RealResource>,
+                    ValueDominanceFunction<RealResource>>,
+    StaticComponent<RealResource, TimeWindowExtensionFunction<RealResource>,
+                    TimeWindowFeasibilityFunction<RealResource>, ValueCostFunction<RealResource>,
+                    ValueDominanceFunction<RealResource>>,
+    StaticComponent<IntResource, AdditionExtensionFunction<IntResource>,
+                    MinMaxFeasibilityFunction<IntResource>, ValueCostFunction<IntResource>,
+                    ValueDominanceFunction<IntResource>>>;
+
 class VRP {
     public:
         VRP(Instance instance);
@@ -196,7 +209,7 @@ class VRP {
 
         // Resource graph. needs to be loaded after time windows and ng neighborhoods are
         // initialized
-        RGraph graph_;
+        RGraph graph_{VRPStaticComponents{}};
 
         std::optional<SolutionOutput> solution_output_;
 
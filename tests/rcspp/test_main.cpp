@@ -14,17 +14,210 @@ int main() {
 
     // Test graph creation, graph update and solving the RCSPP
     auto p =
-    all_tests_rcspp<SimpleDominanceAlgorithm, PushingDominanceAlgorithm, PullingDominanceAlgorithm>();
+    all_tests_rcspp<SimpleDominanceAlgorithm, PushingDominanceAlgorithm, PullingDominanceAlgorithm,
+                    ParallelDominanceAlgorithm, BestFirstDominanceAlgorithm>();
     passed += p.first;
     total += p.second;
 
     // Test graph creation and graph update with non integer dual 
     // row coefficients, and solving the RCSPP
     p =
-    all_tests_rcspp_non_integer_dual_row_coef<SimpleDominanceAlgorithm, PushingDominanceAlgorithm, PullingDominanceAlgorithm>();
+    all_tests_rcspp_non_integer_dual_row_coef<SimpleDominanceAlgorithm, PushingDominanceAlgorithm, PullingDominanceAlgorithm,
+                    ParallelDominanceAlgorithm, BestFirstDominanceAlgorithm>();
     passed += p.first;
     total += p.second;
 
+    // Test solving the RCSPP with the bidirectional algorithm
+    LOG_INFO("Run test test_rcspp_bidirectional\n");
+    if (test_rcspp_bidirectional()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_bidirectional\n");
+    }
+    ++total;
+
+    // Test the bidirectional algorithm against the simple dominance algorithm
+    LOG_INFO("Run test test_rcspp_bidirectional_late_returns\n");
+    if (test_rcspp_bidirectional_late_returns()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_bidirectional_late_returns\n");
+    }
+    ++total;
+
+    // Test solving the RCSPP with the bucket algorithm
+    LOG_INFO("Run test test_rcspp_bucket\n");
+    if (test_rcspp_bucket()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_bucket\n");
+    }
+    ++total;
+
+    // Test solving the RCSPP with the static composition functions
+    LOG_INFO("Run test test_rcspp_static\n");
+    if (test_rcspp_static()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_static\n");
+    }
+    ++total;
+
+    // Test concurrent solves on the same graph
+    LOG_INFO("Run test test_rcspp_concurrent\n");
+    if (test_rcspp_concurrent()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_concurrent\n");
+    }
+    ++total;
+
+    // Test re-solving the RCSPP from the labels of the previous solve
+    LOG_INFO("Run test test_rcspp_warm_start\n");
+    if (test_rcspp_warm_start()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_warm_start\n");
+    }
+    ++total;
+
+    // Test re-solving the RCSPP in parallel from the labels of the previous solve
+    LOG_INFO("Run test test_rcspp_parallel_warm_start\n");
+    if (test_rcspp_parallel_warm_start()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_parallel_warm_start\n");
+    }
+    ++total;
+
+    // Test several warm solves in a row
+    LOG_INFO("Run test test_rcspp_consecutive_warm_starts\n");
+    if (test_rcspp_consecutive_warm_starts()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_consecutive_warm_starts\n");
+    }
+    ++total;
+
+    // Test solving the RCSPP for a batch of duals
+    LOG_INFO("Run test test_rcspp_batch\n");
+    if (test_rcspp_batch()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_batch\n");
+    }
+    ++total;
+
+    // Test racing several algorithms on the same graph
+    LOG_INFO("Run test test_rcspp_portfolio\n");
+    if (test_rcspp_portfolio()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_portfolio\n");
+    }
+    ++total;
+
+    // Test the parallel diversification search
+    LOG_INFO("Run test test_rcspp_parallel_diversification\n");
+    if (test_rcspp_parallel_diversification()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_parallel_diversification\n");
+    }
+    ++total;
+
+    // Test stopping the solve at the time limit or on cancellation
+    LOG_INFO("Run test test_rcspp_time_limit\n");
+    if (test_rcspp_time_limit()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_time_limit\n");
+    }
+    ++total;
+
+    // Test streaming the solutions while solving
+    LOG_INFO("Run test test_rcspp_streaming\n");
+    if (test_rcspp_streaming()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_streaming\n");
+    }
+    ++total;
+
+    // Test degrading the solve once the label budget is exceeded
+    LOG_INFO("Run test test_rcspp_label_budget\n");
+    if (test_rcspp_label_budget()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_rcspp_label_budget\n");
+    }
+    ++total;
+
+    // Test the bitset operations
+    LOG_INFO("Run test test_bitset_resource\n");
+    if (test_bitset_resource()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_bitset_resource\n");
+    }
+    ++total;
+
+    // Test the bitset kernels
+    LOG_INFO("Run test test_bitset_kernels\n");
+    if (test_bitset_kernels()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_bitset_kernels\n");
+    }
+    ++total;
+
+    // Test the fixed bitset operations and functions
+    LOG_INFO("Run test test_fixed_bitset_resource\n");
+    if (test_fixed_bitset_resource()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_fixed_bitset_resource\n");
+    }
+    ++total;
+
+    // Test the in-place container operations and the ng-path extension
+    LOG_INFO("Run test test_in_place_container_operations\n");
+    if (test_in_place_container_operations<SetResource<size_t>>("SetResource") &&
+        test_in_place_container_operations<BitsetResource<size_t>>("BitsetResource") &&
+        test_in_place_container_operations<FixedBitsetResource<200>>("FixedBitsetResource")) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_in_place_container_operations\n");
+    }
+    ++total;
+
+    // Test the dominance signatures
+    LOG_INFO("Run test test_dominance_signature\n");
+    if (test_dominance_signature()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_dominance_signature\n");
+    }
+    ++total;
+
+    // Test the dominance index
+    LOG_INFO("Run test test_dominance_index\n");
+    if (test_dominance_index()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_dominance_index\n");
+    }
+    ++total;
+
+    // Test the dominance kernels
+    LOG_INFO("Run test test_dominance_kernels\n");
+    if (test_dominance_kernels()) {
+        ++passed;
+    } else {
+        LOG_ERROR("Test fail for test_dominance_kernels\n");
+    }
+    ++total;
+
     LOG_INFO(passed, "/", total, " tests passed\n");
 
     return total - passed;  // return the number of failed tests
@@ -5,18 +5,26 @@
 #include "vrp/instance_reader.hpp"
 #include "vrp_subproblem/vrp_subproblem.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <random>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_set>
 
 using namespace rcspp;
 
-template <template <typename> class AlgorithmType = SimpleDominanceAlgorithm>
-bool test_vrp_solve(const std::map<size_t, double>& dual_by_id, VRPSubproblem* vrp_subproblem,
-  double optimal_cost) {
-
-    auto solutions = vrp_subproblem->solve<AlgorithmType>(dual_by_id);
+// Optimal costs of the subproblem of R101 with the duals of the iterations 0 and 1.
+const double OPTIMAL_COST_ITER_0 = -319.87786809696524415;
+const double OPTIMAL_COST_ITER_1 = -291.88751273511473983;
 
+inline bool test_vrp_solve(const std::vector<Solution>& solutions, double optimal_cost) {
     if (!solutions.empty()) {
         auto cost = solutions[0].cost;
         LOG_DEBUG("cost=", cost, '\n');
@@ -32,6 +40,12 @@ bool test_vrp_solve(const std::map<size_t, double>& dual_by_id, VRPSubproblem* v
     return true;
 }
 
+template <template <typename> class AlgorithmType = SimpleDominanceAlgorithm>
+bool test_vrp_solve(const std::map<size_t, double>& dual_by_id, VRPSubproblem* vrp_subproblem,
+  double optimal_cost) {
+    return test_vrp_solve(vrp_subproblem->solve<AlgorithmType>(dual_by_id), optimal_cost);
+}
+
 template <template <typename> class AlgorithmType = SimpleDominanceAlgorithm>
 bool test_rcspp() {
   // Test graph creation, graph update and solving the RCSPP
@@ -49,7 +63,6 @@ bool test_rcspp() {
   VRPSubproblem vrp_subproblem(instance);
 
   // Iteration 0: Test graph creation
-  const double OPTIMAL_COST_ITER_0 = -319.87786809696524415;
   std::string duals_file = "iter_0.txt";
   std::string duals_directory = root_dir+"/instances/duals/" + instance_name + "/";
   auto duals_path = duals_directory + duals_file;
@@ -60,7 +73,6 @@ bool test_rcspp() {
     }
 
   // Iteration 1: Test graph update
-  const double OPTIMAL_COST_ITER_1 = -291.88751273511473983;
   duals_file = "iter_1.txt";
   duals_directory = root_dir+"/instances/duals/" + instance_name + "/";
   duals_path = duals_directory + duals_file;
@@ -95,7 +107,6 @@ bool test_rcspp_non_integer_dual_row_coef() {
     VRPSubproblem vrp_subproblem(instance, &coef_by_id);
 
     // Iteration 0: Test graph creation
-    const double OPTIMAL_COST_ITER_0 = -319.87786809696524;
     std::string duals_file = "iter_0.txt";
     std::string duals_directory = root_dir+"/instances/duals/" + instance_name + "/";
     auto duals_path = duals_directory + duals_file;
@@ -113,7 +124,6 @@ bool test_rcspp_non_integer_dual_row_coef() {
     }
 
     // Iteration 1: Test graph update
-    const double OPTIMAL_COST_ITER_1 = -291.88751273511473983;
     duals_file = "iter_1.txt";
     duals_directory = root_dir+"/instances/duals/" + instance_name + "/";
     duals_path = duals_directory + duals_file;
@@ -128,3 +138,1136 @@ bool test_rcspp_non_integer_dual_row_coef() {
 
     return success;
 }
+
+// Subproblem of R101 with the duals of the iterations 0 and 1. The subproblem is allocated on the
+// heap since its graphs reference its time windows.
+struct R101Subproblem {
+        std::unique_ptr<VRPSubproblem> vrp_subproblem;
+        std::map<size_t, double> dual_by_id_iter_0;
+        std::map<size_t, double> dual_by_id_iter_1;
+};
+
+inline R101Subproblem read_r101_subproblem() {
+    std::string instance_name = "R101";
+    std::string root_dir = file_parent_dir(__FILE__, 3);
+    std::string instance_path = root_dir + "/instances/" + instance_name + ".txt";
+
+    LOG_INFO("Instance: ", instance_path, '\n');
+    InstanceReader instance_reader(instance_path);
+    auto instance = instance_reader.read();
+
+    std::string duals_directory = root_dir + "/instances/duals/" + instance_name + "/";
+    return {std::make_unique<VRPSubproblem>(instance),
+            InstanceReader::read_duals(duals_directory + "iter_0.txt"),
+            InstanceReader::read_duals(duals_directory + "iter_1.txt")};
+}
+
+// Subproblem of a random instance in the Solomon format with two random dual vectors (see
+// generate_subproblem).
+struct GeneratedSubproblem {
+        std::unique_ptr<VRPSubproblem> vrp_subproblem;
+        std::map<size_t, double> dual_by_id_0;
+        std::map<size_t, double> dual_by_id_1;
+};
+
+// Random instance in the Solomon format: depot at the center of a 100 x 100 square with the
+// horizon 230 as due date, customers with a service time of 10 and time windows of width 30 that
+// can end at the horizon (i.e., a customer can be served too late to return to the depot by the
+// horizon). The duals of a customer are 0.5 to 2 times its distance to the depot.
+inline GeneratedSubproblem generate_subproblem(int nb_customers, unsigned seed) {
+    const int horizon = 230;
+    const int capacity = 200;
+    const int service_time = 10;
+    const int time_window_width = 30;
+
+    std::mt19937 rnd(seed);
+    std::uniform_real_distribution<double> position_dist(0.0, 100.0);
+    std::uniform_int_distribution<int> demand_dist(1, 30);
+    std::uniform_int_distribution<int> ready_time_dist(0, horizon - time_window_width);
+
+    Instance instance(nb_customers, capacity, "GEN" + std::to_string(seed));
+    const auto& depot = instance.add_customer(0, 50.0, 50.0, 0, 0, horizon, 0, true);
+    const double depot_x = depot.pos_x;
+    const double depot_y = depot.pos_y;
+    for (int customer_id = 1; customer_id <= nb_customers; ++customer_id) {
+        const int ready_time = ready_time_dist(rnd);
+        instance.add_customer(customer_id,
+                              position_dist(rnd),
+                              position_dist(rnd),
+                              demand_dist(rnd),
+                              ready_time,
+                              ready_time + time_window_width,
+                              service_time);
+    }
+
+    std::uniform_real_distribution<double> dual_factor_dist(0.5, 2.0);
+    std::map<size_t, double> dual_by_id_0;
+    std::map<size_t, double> dual_by_id_1;
+    for (const auto& [customer_id, customer] : instance.get_customers_by_id()) {
+        if (!customer.depot) {
+            const double distance =
+                std::hypot(customer.pos_x - depot_x, customer.pos_y - depot_y);
+            dual_by_id_0.emplace(customer_id, dual_factor_dist(rnd) * distance);
+            dual_by_id_1.emplace(customer_id, dual_factor_dist(rnd) * distance);
+        }
+    }
+
+    return {std::make_unique<VRPSubproblem>(instance), dual_by_id_0, dual_by_id_1};
+}
+
+using VRPSolveFunction =
+    std::function<std::vector<Solution>(VRPSubproblem*, const std::map<size_t, double>&)>;
+
+inline bool test_rcspp_r101(const VRPSolveFunction& solve) {
+    // Test solving the RCSPP on R101 with a given solve method of the subproblem
+
+    auto r101 = read_r101_subproblem();
+    VRPSubproblem* vrp_subproblem = r101.vrp_subproblem.get();
+    if (!test_vrp_solve(solve(vrp_subproblem, r101.dual_by_id_iter_0), OPTIMAL_COST_ITER_0)) {
+        return false;
+    }
+    return test_vrp_solve(solve(vrp_subproblem, r101.dual_by_id_iter_1), OPTIMAL_COST_ITER_1);
+}
+
+inline bool test_rcspp_bidirectional() {
+    // Test solving the RCSPP with the bidirectional algorithm (forward and backward graphs)
+    return test_rcspp_r101(
+        [](VRPSubproblem* vrp_subproblem, const std::map<size_t, double>& dual_by_id) {
+            return vrp_subproblem->solve_bidirectional(dual_by_id);
+        });
+}
+
+inline bool test_rcspp_bidirectional_late_returns() {
+    // Test the bidirectional algorithm against the simple dominance algorithm on generated
+    // instances, where some customers can only be served too late to return to the depot by its
+    // due time (the backward graph must mirror the forward graph, which allows these returns)
+
+    for (unsigned seed = 0; seed < 5; ++seed) {  // NOLINT
+        auto generated = generate_subproblem(40, seed);  // NOLINT
+        VRPSubproblem& vrp_subproblem = *generated.vrp_subproblem;
+        for (const auto* dual_by_id : {&generated.dual_by_id_0, &generated.dual_by_id_1}) {
+            const double optimal_cost = vrp_subproblem.solve(*dual_by_id)[0].cost;
+            if (!test_vrp_solve(vrp_subproblem.solve_bidirectional(*dual_by_id), optimal_cost)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+inline bool test_rcspp_bucket() {
+    // Test solving the RCSPP with the labels bucketed by time
+    return test_rcspp_r101(
+        [](VRPSubproblem* vrp_subproblem, const std::map<size_t, double>& dual_by_id) {
+            // 100 time buckets over the horizon of R101
+            const double bucket_size = 230.0 / 100.0;  // NOLINT
+            auto algorithm = vrp_subproblem->create_algorithm<BucketDominanceAlgorithm>(
+                AlgorithmParams{},
+                [](const Resource<ResourceComposition<RealResource, IntResource>>& resource) {
+                    return resource.get_resource_component<0>(1).get_value();
+                },
+                bucket_size);
+            return vrp_subproblem->solve_with_algorithm(dual_by_id, algorithm.get());
+        });
+}
+
+inline bool test_rcspp_static() {
+    // Test solving the RCSPP with the static composition functions
+    return test_rcspp_r101(
+        [](VRPSubproblem* vrp_subproblem, const std::map<size_t, double>& dual_by_id) {
+            return vrp_subproblem->solve_static(dual_by_id);
+        });
+}
+
+inline bool test_rcspp_concurrent() {
+    // Test concurrent solves on the same graph with different upper bounds. Each solve waits at
+    // its first solution until all the solves reach theirs: the solves must overlap, i.e., not
+    // run one after the other.
+    return test_rcspp_r101(
+        [](VRPSubproblem* vrp_subproblem, const std::map<size_t, double>& dual_by_id) {
+            const std::vector<double> upper_bounds = {0.0, -100.0, -200.0, -250.0};
+            std::atomic<size_t> num_waiting_solves{0};
+            std::atomic<bool> overlapped{true};
+            auto callback = [&, first = true](const Solution& /*solution*/) mutable {
+                if (first) {
+                    first = false;
+                    ++num_waiting_solves;
+                    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                    while (num_waiting_solves < upper_bounds.size()) {
+                        if (std::chrono::steady_clock::now() > deadline) {
+                            overlapped = false;
+                            break;
+                        }
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+                return true;
+            };
+            auto solutions_by_solve =
+                vrp_subproblem->solve_concurrently(dual_by_id, upper_bounds, callback);
+            if (!overlapped) {
+                LOG_ERROR("The concurrent solves did not overlap\n");
+                return std::vector<Solution>{};
+            }
+            // all the solves must find the same optimal solution
+            for (const auto& solutions : solutions_by_solve) {
+                if (solutions.empty() ||
+                    std::abs(solutions[0].cost - solutions_by_solve[0][0].cost) > 1e-9) {
+                    return std::vector<Solution>{};
+                }
+            }
+            return solutions_by_solve[0];
+        });
+}
+
+inline bool test_rcspp_portfolio() {
+    // Test racing several algorithms on the same graph
+    return test_rcspp_r101(
+        [](VRPSubproblem* vrp_subproblem, const std::map<size_t, double>& dual_by_id) {
+            std::vector<std::unique_ptr<Algorithm<ResourceComposition<RealResource, IntResource>>>>
+                algorithms;
+            algorithms.push_back(vrp_subproblem->create_algorithm(AlgorithmParams{}));
+            algorithms.push_back(
+                vrp_subproblem->create_algorithm<PushingDominanceAlgorithm>(AlgorithmParams{}));
+            algorithms.push_back(
+                vrp_subproblem->create_algorithm<PullingDominanceAlgorithm>(AlgorithmParams{}));
+            AlgorithmParams diversification_params;
+            diversification_params.max_iterations = 10;  // NOLINT
+            algorithms.push_back(
+                vrp_subproblem->create_algorithm<DiversificationSearch>(diversification_params));
+            auto algorithm = vrp_subproblem->create_algorithm<PortfolioAlgorithm>(
+                AlgorithmParams{}, std::move(algorithms));
+            return vrp_subproblem->solve_with_algorithm(dual_by_id, algorithm.get());
+        });
+}
+
+inline bool test_rcspp_parallel_diversification() {
+    // Test the parallel diversification search: its trajectories diverge and their solutions are
+    // merged, i.e., it finds at least as many distinct solutions as a single trajectory with the
+    // same number of iterations, none cheaper than the optimum
+
+    auto r101 = read_r101_subproblem();
+    VRPSubproblem& vrp_subproblem = *r101.vrp_subproblem;
+    AlgorithmParams params;
+    params.max_iterations = 10;  // NOLINT
+    auto single_algorithm = vrp_subproblem.create_algorithm<DiversificationSearch>(params);
+    params.num_threads = 4;  // NOLINT
+    auto algorithm = vrp_subproblem.create_algorithm<ParallelDiversificationSearch>(params);
+    for (const auto& [dual_by_id, optimal_cost] :
+         {std::pair{r101.dual_by_id_iter_0, OPTIMAL_COST_ITER_0},
+          std::pair{r101.dual_by_id_iter_1, OPTIMAL_COST_ITER_1}}) {
+        auto solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+        auto single_solutions =
+            vrp_subproblem.solve_with_algorithm(dual_by_id, single_algorithm.get());
+        std::unordered_set<Solution> distinct_solutions(solutions.begin(), solutions.end());
+        std::unordered_set<Solution> single_distinct_solutions(single_solutions.begin(),
+                                                               single_solutions.end());
+        LOG_DEBUG("Distinct solutions: ",
+                  distinct_solutions.size(),
+                  " in parallel, ",
+                  single_distinct_solutions.size(),
+                  " with one trajectory\n");
+        if (solutions.empty() || distinct_solutions.size() != solutions.size() ||
+            distinct_solutions.size() < single_distinct_solutions.size() ||
+            solutions[0].cost < optimal_cost - 1e-9) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline bool test_rcspp_time_limit() {
+    // Test stopping the solve at the time limit or on cancellation
+
+    auto r101 = read_r101_subproblem();
+    VRPSubproblem& vrp_subproblem = *r101.vrp_subproblem;
+    const auto& dual_by_id = r101.dual_by_id_iter_0;
+
+    // No time: stops before the end
+    AlgorithmParams params;
+    params.time_limit = 0.0;
+    auto algorithm = vrp_subproblem.create_algorithm(params);
+    vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (algorithm->is_optimal()) {
+        return false;
+    }
+
+    // Cancelled: stops before the end
+    params = AlgorithmParams{};
+    params.cancellation_token.cancel();
+    algorithm = vrp_subproblem.create_algorithm(params);
+    vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (algorithm->is_optimal()) {
+        return false;
+    }
+
+    // Enough time: optimal
+    params = AlgorithmParams{};
+    params.time_limit = 60.0;  // NOLINT
+    algorithm = vrp_subproblem.create_algorithm(params);
+    auto solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (!algorithm->is_optimal() || !test_vrp_solve(solutions, OPTIMAL_COST_ITER_0)) {
+        return false;
+    }
+
+    // Cancelled at the first solution, then re-solved with the same algorithm: optimal
+    params = AlgorithmParams{};
+    algorithm = vrp_subproblem.create_algorithm(params);
+    algorithm->set_solution_callback([&params](const Solution& /*solution*/) {
+        params.cancellation_token.cancel();
+        return true;
+    });
+    vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (algorithm->is_optimal()) {
+        return false;
+    }
+    params.cancellation_token.reset();
+    algorithm->set_solution_callback(nullptr);
+    solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    return algorithm->is_optimal() && test_vrp_solve(solutions, OPTIMAL_COST_ITER_0);
+}
+
+inline bool test_rcspp_label_budget() {
+    // Test degrading the solve once the label budget is exceeded
+
+    auto r101 = read_r101_subproblem();
+    VRPSubproblem& vrp_subproblem = *r101.vrp_subproblem;
+    const auto& dual_by_id = r101.dual_by_id_iter_0;
+
+    // Small budget: solutions, not cheaper than the optimal one, but not optimal
+    AlgorithmParams params;
+    params.max_num_labels = 100;  // NOLINT
+    auto algorithm = vrp_subproblem.create_algorithm(params);
+    auto solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (algorithm->is_optimal() || solutions.empty() ||
+        solutions[0].cost < OPTIMAL_COST_ITER_0 - 1e-9) {
+        return false;
+    }
+
+    // Large budget: optimal
+    params.max_num_labels = 100000000;  // NOLINT
+    algorithm = vrp_subproblem.create_algorithm(params);
+    solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (!algorithm->is_optimal() || !test_vrp_solve(solutions, OPTIMAL_COST_ITER_0)) {
+        return false;
+    }
+
+    // Large budget, stopped from the callback, then re-solved with the same algorithm (the labels
+    // of the stopped solve do not count in the budget): optimal
+    algorithm = vrp_subproblem.create_algorithm(params);
+    bool stop = true;
+    algorithm->set_solution_callback([&stop](const Solution& /*solution*/) { return !stop; });
+    vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (algorithm->is_optimal()) {
+        return false;
+    }
+    stop = false;
+    solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    return algorithm->is_optimal() && test_vrp_solve(solutions, OPTIMAL_COST_ITER_0);
+}
+
+inline bool test_rcspp_streaming() {
+    // Test streaming the solutions while solving, and stopping from the callback
+
+    auto r101 = read_r101_subproblem();
+    VRPSubproblem& vrp_subproblem = *r101.vrp_subproblem;
+    const auto& dual_by_id = r101.dual_by_id_iter_0;
+
+    // All the solutions returned are streamed
+    std::vector<Solution> streamed_solutions;
+    auto streaming_algorithm = vrp_subproblem.create_algorithm(AlgorithmParams{});
+    streaming_algorithm->set_solution_callback([&streamed_solutions](const Solution& solution) {
+        streamed_solutions.push_back(solution);
+        return true;
+    });
+    auto solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, streaming_algorithm.get());
+    if (!streaming_algorithm->is_optimal() || !test_vrp_solve(solutions, OPTIMAL_COST_ITER_0) ||
+        streamed_solutions.size() != solutions.size()) {
+        return false;
+    }
+
+    // Stop at the first solution
+    size_t nb_streamed_solutions = 0;
+    streaming_algorithm->set_solution_callback(
+        [&nb_streamed_solutions](const Solution& /*solution*/) {
+            ++nb_streamed_solutions;
+            return false;
+        });
+    solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, streaming_algorithm.get());
+    if (streaming_algorithm->is_optimal() || nb_streamed_solutions != 1 || solutions.empty()) {
+        return false;
+    }
+
+    // In parallel: the solutions are streamed by the workers, and all the workers stop at the
+    // first solution
+    AlgorithmParams parallel_params;
+    parallel_params.num_threads = 4;
+    auto parallel_algorithm =
+        vrp_subproblem.create_algorithm<ParallelDominanceAlgorithm>(parallel_params);
+    streamed_solutions.clear();
+    parallel_algorithm->set_solution_callback([&streamed_solutions](const Solution& solution) {
+        streamed_solutions.push_back(solution);
+        return true;
+    });
+    solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, parallel_algorithm.get());
+    if (!parallel_algorithm->is_optimal() || !test_vrp_solve(solutions, OPTIMAL_COST_ITER_0) ||
+        streamed_solutions.size() != solutions.size()) {
+        return false;
+    }
+    nb_streamed_solutions = 0;
+    parallel_algorithm->set_solution_callback(
+        [&nb_streamed_solutions](const Solution& /*solution*/) {
+            ++nb_streamed_solutions;
+            return false;
+        });
+    // the workers stopped before finding all the solutions
+    solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, parallel_algorithm.get());
+    if (parallel_algorithm->is_optimal() || nb_streamed_solutions != 1 || solutions.empty() ||
+        solutions.size() >= streamed_solutions.size()) {
+        return false;
+    }
+
+    // Stopped from the callback, then re-solved with the same algorithm: optimal
+    auto algorithm = vrp_subproblem.create_algorithm(AlgorithmParams{});
+    bool stop = true;
+    algorithm->set_solution_callback([&stop](const Solution& /*solution*/) { return !stop; });
+    vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    if (algorithm->is_optimal()) {
+        return false;
+    }
+    stop = false;
+    solutions = vrp_subproblem.solve_with_algorithm(dual_by_id, algorithm.get());
+    return algorithm->is_optimal() && test_vrp_solve(solutions, OPTIMAL_COST_ITER_0);
+}
+
+inline bool test_rcspp_warm_start() {
+    // Test re-solving the RCSPP from the labels of the previous solve
+
+    auto r101 = read_r101_subproblem();
+    VRPSubproblem& vrp_subproblem = *r101.vrp_subproblem;
+    AlgorithmParams params;
+    params.warm_start = true;
+    auto algorithm = vrp_subproblem.create_algorithm(params);
+
+    // First solve: from scratch
+    auto solutions = vrp_subproblem.solve_with_algorithm(r101.dual_by_id_iter_0, algorithm.get());
+    if (!test_vrp_solve(solutions, OPTIMAL_COST_ITER_0) || !algorithm->is_optimal()) {
+        return false;
+    }
+
+    // Same duals: the labels of the previous solve give the optimal solution
+    solutions = vrp_subproblem.solve_with_algorithm(r101.dual_by_id_iter_0, algorithm.get());
+    if (!test_vrp_solve(solutions, OPTIMAL_COST_ITER_0) || algorithm->is_optimal()) {
+        return false;
+    }
+
+    // New duals: the solutions cannot be cheaper than the optimal solution
+    solutions = vrp_subproblem.solve_with_algorithm(r101.dual_by_id_iter_1, algorithm.get());
+    if (algorithm->is_optimal()) {
+        return test_vrp_solve(solutions, OPTIMAL_COST_ITER_1);
+    }
+    return !solutions.empty() && solutions[0].cost > OPTIMAL_COST_ITER_1 - 1e-9;
+}
+
+inline bool test_rcspp_parallel_warm_start() {
+    // Test re-solving the RCSPP in parallel from the labels of the previous solve: the labels of
+    // the threads come from several pools, the ancestors of the labels at the sinks must still be
+    // updated before them (i.e., the cost of a solution is the reduced cost of its path), and
+    // the solutions cannot be cheaper than the optimal solution
+
+    for (unsigned seed = 0; seed < 5; ++seed) {  // NOLINT
+        for (size_t num_threads : {4, 8}) {  // NOLINT
+            auto generated = generate_subproblem(40, seed);  // NOLINT
+            VRPSubproblem& vrp_subproblem = *generated.vrp_subproblem;
+            const double optimal_cost = vrp_subproblem.solve(generated.dual_by_id_1)[0].cost;
+
+            AlgorithmParams params;
+            params.warm_start = true;
+            params.num_threads = num_threads;
+            auto algorithm = vrp_subproblem.create_algorithm<ParallelDominanceAlgorithm>(params);
+            vrp_subproblem.solve_with_algorithm(generated.dual_by_id_0, algorithm.get());
+            auto solutions =
+                vrp_subproblem.solve_with_algorithm(generated.dual_by_id_1, algorithm.get());
+            if (solutions.empty()) {
+                return false;
+            }
+            for (const auto& solution : solutions) {
+                const double reduced_cost =
+                    vrp_subproblem.calculate_reduced_cost(solution, generated.dual_by_id_1);
+                if (std::abs(solution.cost - reduced_cost) > 1e-6 ||
+                    solution.cost < optimal_cost - 1e-9) {
+                    LOG_ERROR("Solution of cost ",
+                              solution.cost,
+                              " for a path of reduced cost ",
+                              reduced_cost,
+                              " (optimal cost ",
+                              optimal_cost,
+                              ")\n");
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+inline bool test_rcspp_consecutive_warm_starts() {
+    // Test several warm solves in a row: each one re-evaluates all the labels at the sinks of the
+    // last cold solve, so that re-solving with the duals of the cold solve (after other duals)
+    // returns its optimal solution again, and the cost of a solution is always the reduced cost
+    // of its path
+
+    for (unsigned seed = 0; seed < 5; ++seed) {  // NOLINT
+        for (size_t num_threads : {1, 4}) {  // NOLINT
+            auto generated = generate_subproblem(40, seed);  // NOLINT
+            VRPSubproblem& vrp_subproblem = *generated.vrp_subproblem;
+            const std::vector<std::map<size_t, double>> dual_by_ids = {generated.dual_by_id_0,
+                                                                       generated.dual_by_id_1,
+                                                                       generated.dual_by_id_0,
+                                                                       generated.dual_by_id_1};
+            const std::vector<double> optimal_costs = {
+                vrp_subproblem.solve(generated.dual_by_id_0)[0].cost,
+                vrp_subproblem.solve(generated.dual_by_id_1)[0].cost};
+
+            AlgorithmParams params;
+            params.warm_start = true;
+            params.num_threads = num_threads;
+            auto algorithm =
+                num_threads > 1
+                    ? vrp_subproblem.create_algorithm<ParallelDominanceAlgorithm>(params)
+                    : vrp_subproblem.create_algorithm<SimpleDominanceAlgorithm>(params);
+            for (size_t i = 0; i < dual_by_ids.size(); ++i) {
+                const double optimal_cost = optimal_costs[i % 2];
+                auto solutions =
+                    vrp_subproblem.solve_with_algorithm(dual_by_ids[i], algorithm.get());
+                if (solutions.empty()) {
+                    return false;
+                }
+                for (const auto& solution : solutions) {
+                    const double reduced_cost =
+                        vrp_subproblem.calculate_reduced_cost(solution, dual_by_ids[i]);
+                    if (std::abs(solution.cost - reduced_cost) > 1e-6 ||
+                        solution.cost < optimal_cost - 1e-9) {
+                        LOG_ERROR("Solve ",
+                                  i,
+                                  ": solution of cost ",
+                                  solution.cost,
+                                  " for a path of reduced cost ",
+                                  reduced_cost,
+                                  " (optimal cost ",
+                                  optimal_cost,
+                                  ")\n");
+                        return false;
+                    }
+                }
+                // the labels of the cold solve include its optimal solution
+                if (i % 2 == 0 && std::abs(solutions[0].cost - optimal_cost) > 1e-6) {
+                    LOG_ERROR("Solve ",
+                              i,
+                              ": best cost ",
+                              solutions[0].cost,
+                              " instead of ",
+                              optimal_cost,
+                              "\n");
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+inline bool test_rcspp_batch() {
+    // Test solving the RCSPP for a batch of duals in a single call
+
+    auto r101 = read_r101_subproblem();
+    auto solutions_batch = r101.vrp_subproblem->solve_batch(
+        {r101.dual_by_id_iter_0, r101.dual_by_id_iter_1, r101.dual_by_id_iter_0});
+
+    return solutions_batch.size() == 3 &&
+           test_vrp_solve(solutions_batch[0], OPTIMAL_COST_ITER_0) &&
+           test_vrp_solve(solutions_batch[1], OPTIMAL_COST_ITER_1) &&
+           test_vrp_solve(solutions_batch[2], OPTIMAL_COST_ITER_0);
+}
+
+inline bool test_bitset_resource() {
+    // Test the bitset operations (SIMD kernels if supported) against the set operations
+
+    std::mt19937 rnd(0);
+    for (size_t iter = 0; iter < 200; ++iter) {
+        // sizes of 1 to 20 words, sparse and dense sets
+        std::uniform_int_distribution<size_t> max_value_dist(1, 20 * 64);
+        const size_t max_value_a = max_value_dist(rnd);
+        const size_t max_value_b = max_value_dist(rnd);
+        std::bernoulli_distribution in_set(iter % 2 == 0 ? 0.02 : 0.9);
+        std::set<size_t> set_a;
+        std::set<size_t> set_b;
+        for (size_t i = 0; i < max_value_a; ++i) {
+            if (in_set(rnd)) {
+                set_a.insert(i);
+            }
+        }
+        for (size_t i = 0; i < max_value_b; ++i) {
+            // b is often a subset of a, to test includes
+            if (iter % 3 == 0 ? set_a.contains(i) && in_set(rnd) : in_set(rnd)) {
+                set_b.insert(i);
+            }
+        }
+
+        BitsetResource<size_t> bitset_a(set_a);
+        BitsetResource<size_t> bitset_b(set_b);
+        SetResource<size_t> sets_a;
+        sets_a.set_value(set_a);
+
+        const auto to_set = [](const std::vector<uint64_t>& words) {
+            std::set<size_t> values;
+            for (size_t i = 0; i < 64 * words.size(); ++i) {
+                if (((words[i / 64] >> (i % 64)) & 1ULL) != 0ULL) {
+                    values.insert(i);
+                }
+            }
+            return values;
+        };
+
+        if (bitset_a.includes(bitset_b.get_value()) != sets_a.includes(set_b) ||
+            bitset_a.intersects(bitset_b.get_value()) != sets_a.intersects(set_b) ||
+            to_set(bitset_a.get_union(bitset_b.get_value())) != sets_a.get_union(set_b) ||
+            to_set(bitset_a.get_intersection(bitset_b.get_value())) !=
+                sets_a.get_intersection(set_b)) {
+            LOG_ERROR("Bitset operations differ from the set operations (iteration ", iter, ")\n");
+            return false;
+        }
+
+        // in-place variants
+        auto union_bitset = bitset_a;
+        union_bitset.add(bitset_b.get_value());
+        auto intersection_bitset = bitset_a;
+        intersection_bitset.intersect_with(bitset_b.get_value());
+        if (to_set(union_bitset.get_value()) != sets_a.get_union(set_b) ||
+            to_set(intersection_bitset.get_value()) != sets_a.get_intersection(set_b)) {
+            LOG_ERROR("In-place bitset operations differ from the set operations (iteration ",
+                      iter,
+                      ")\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline bool test_bitset_kernels() {
+    // Test the bitset kernels (scalar, AVX2 and AVX-512) against the set operations
+
+    struct BitsetKernels {
+            bool (*includes)(const uint64_t*, const uint64_t*, size_t);
+            bool (*intersects)(const uint64_t*, const uint64_t*, size_t);
+            void (*or_into)(uint64_t*, const uint64_t*, size_t);
+            void (*and_into)(uint64_t*, const uint64_t*, size_t);
+    };
+    std::vector<std::pair<std::string, BitsetKernels>> kernels = {
+        {"scalar",
+         {bitset_kernels::includes_scalar,
+          bitset_kernels::intersects_scalar,
+          bitset_kernels::or_into_scalar,
+          bitset_kernels::and_into_scalar}},
+        {"dispatch",
+         {bitset_kernels::includes,
+          bitset_kernels::intersects,
+          bitset_kernels::or_into,
+          bitset_kernels::and_into}}};
+#ifdef RCSPP_BITSET_SIMD
+    if (__builtin_cpu_supports("avx2") != 0) {
+        kernels.push_back({"avx2",
+                           {bitset_kernels::includes_avx2,
+                            bitset_kernels::intersects_avx2,
+                            bitset_kernels::or_into_avx2,
+                            bitset_kernels::and_into_avx2}});
+    }
+    if (__builtin_cpu_supports("avx512f") != 0) {
+        kernels.push_back({"avx512",
+                           {bitset_kernels::includes_avx512,
+                            bitset_kernels::intersects_avx512,
+                            bitset_kernels::or_into_avx512,
+                            bitset_kernels::and_into_avx512}});
+    }
+#endif
+
+    const auto to_words = [](const std::set<size_t>& values, size_t num_words) {
+        std::vector<uint64_t> words(num_words, 0ULL);
+        for (size_t value : values) {
+            words[value / 64] |= 1ULL << (value % 64);
+        }
+        return words;
+    };
+
+    std::mt19937 rnd(0);
+    for (size_t iter = 0; iter < 200; ++iter) {
+        // 0 to 20 words (including the tails of the SIMD kernels), sparse and dense sets
+        const size_t num_words = rnd() % 21;
+        std::bernoulli_distribution in_set(iter % 2 == 0 ? 0.02 : 0.9);
+        std::set<size_t> set_a;
+        std::set<size_t> set_b;
+        for (size_t i = 0; i < 64 * num_words; ++i) {
+            if (in_set(rnd)) {
+                set_a.insert(i);
+            }
+            // b is often a subset of a, to test includes
+            if (iter % 3 == 0 ? set_a.contains(i) && in_set(rnd) : in_set(rnd)) {
+                set_b.insert(i);
+            }
+        }
+        std::set<size_t> set_union;
+        std::ranges::set_union(set_a, set_b, std::inserter(set_union, set_union.end()));
+        std::set<size_t> set_intersection;
+        std::ranges::set_intersection(
+            set_a, set_b, std::inserter(set_intersection, set_intersection.end()));
+
+        const auto words_a = to_words(set_a, num_words);
+        const auto words_b = to_words(set_b, num_words);
+        for (const auto& [name, kernel] : kernels) {
+            auto union_words = words_a;
+            kernel.or_into(union_words.data(), words_b.data(), num_words);
+            auto intersection_words = words_a;
+            kernel.and_into(intersection_words.data(), words_b.data(), num_words);
+            if (kernel.includes(words_a.data(), words_b.data(), num_words) !=
+                    std::ranges::includes(set_a, set_b) ||
+                kernel.intersects(words_a.data(), words_b.data(), num_words) !=
+                    !set_intersection.empty() ||
+                union_words != to_words(set_union, num_words) ||
+                intersection_words != to_words(set_intersection, num_words)) {
+                LOG_ERROR("Bitset kernel ",
+                          name,
+                          " differs from the set operations (iteration ",
+                          iter,
+                          ")\n");
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+inline bool test_fixed_bitset_resource() {
+    // Test the fixed bitset operations and functions against the set operations
+
+    constexpr size_t capacity = 300;  // 5 words, the last one partially used
+    using FixedBitset = FixedBitsetResource<capacity>;
+
+    std::mt19937 rnd(0);
+    for (size_t iter = 0; iter < 200; ++iter) {
+        std::bernoulli_distribution in_set(iter % 2 == 0 ? 0.02 : 0.9);
+        std::set<size_t> set_a;
+        std::set<size_t> set_b;
+        for (size_t i = 0; i < capacity; ++i) {
+            if (in_set(rnd)) {
+                set_a.insert(i);
+            }
+            // b is often a subset of a, to test includes
+            if (iter % 3 == 0 ? set_a.contains(i) && in_set(rnd) : in_set(rnd)) {
+                set_b.insert(i);
+            }
+        }
+
+        FixedBitset bitset_a(set_a);
+        FixedBitset bitset_b(set_b);
+        SetResource<size_t> sets_a;
+        sets_a.set_value(set_a);
+
+        const auto to_set = [](const FixedBitset::Container& words) {
+            std::set<size_t> values;
+            for (size_t i = 0; i < 64 * words.size(); ++i) {
+                if (((words[i / 64] >> (i % 64)) & 1ULL) != 0ULL) {
+                    values.insert(i);
+                }
+            }
+            return values;
+        };
+
+        if (bitset_a.size() != set_a.size() ||
+            bitset_a.includes(bitset_b.get_value()) != sets_a.includes(set_b) ||
+            bitset_a.intersects(bitset_b.get_value()) != sets_a.intersects(set_b) ||
+            to_set(bitset_a.get_union(bitset_b.get_value())) != sets_a.get_union(set_b) ||
+            to_set(bitset_a.get_intersection(bitset_b.get_value())) !=
+                sets_a.get_intersection(set_b)) {
+            LOG_ERROR("Fixed bitset operations differ from the set operations (iteration ",
+                      iter,
+                      ")\n");
+            return false;
+        }
+
+        // extension and dominance functions
+        Resource<FixedBitset> resource_a(nullptr, nullptr, nullptr, bitset_a);
+        Resource<FixedBitset> extended_resource;
+        Extender<FixedBitset> union_extender(
+            bitset_b, std::make_unique<UnionExtensionFunction<FixedBitset>>(), 0);
+        union_extender.extend(resource_a, &extended_resource);
+        if (to_set(extended_resource.get_value()) != sets_a.get_union(set_b)) {
+            LOG_ERROR("UnionExtensionFunction differs from the set union (iteration ", iter, ")\n");
+            return false;
+        }
+        Extender<FixedBitset> intersection_extender(
+            bitset_b, std::make_unique<IntersectionExtensionFunction<FixedBitset>>(), 0);
+        intersection_extender.extend(resource_a, &extended_resource);
+        if (to_set(extended_resource.get_value()) != sets_a.get_intersection(set_b)) {
+            LOG_ERROR("IntersectionExtensionFunction differs from the set intersection (iteration ",
+                      iter,
+                      ")\n");
+            return false;
+        }
+        Resource<FixedBitset> resource_b(nullptr, nullptr, nullptr, bitset_b);
+        InclusionDominanceFunction<FixedBitset> inclusion_dominance;
+        if (inclusion_dominance.check_dominance(resource_b, resource_a) !=
+            sets_a.includes(set_b)) {
+            LOG_ERROR("InclusionDominanceFunction differs from the set inclusion (iteration ",
+                      iter,
+                      ")\n");
+            return false;
+        }
+
+        bitset_a.reset();
+        if (bitset_a.size() != 0) {
+            LOG_ERROR("Fixed bitset is not empty after a reset (iteration ", iter, ")\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename ResourceType>
+bool test_in_place_container_operations(const std::string& resource_name) {
+    // Test the in-place operations and the ng-path extension against the set operations
+
+    constexpr size_t max_value = 200;
+
+    const auto to_set = [](const ResourceType& resource) {
+        std::set<size_t> values;
+        for (size_t i = 0; i < max_value; ++i) {
+            if (resource.contains(i)) {
+                values.insert(i);
+            }
+        }
+        return values;
+    };
+
+    std::mt19937 rnd(0);
+    std::bernoulli_distribution in_set(0.3);
+    for (size_t iter = 0; iter < 100; ++iter) {
+        std::set<size_t> set_a;
+        std::set<size_t> set_b;
+        for (size_t i = 0; i < max_value; ++i) {
+            if (in_set(rnd)) {
+                set_a.insert(i);
+            }
+            if (in_set(rnd)) {
+                set_b.insert(i);
+            }
+        }
+        SetResource<size_t> sets_a;
+        sets_a.set_value(set_a);
+        const auto set_union = sets_a.get_union(set_b);
+        const auto set_intersection = sets_a.get_intersection(set_b);
+
+        ResourceType a;
+        a.set_value(set_a);
+        ResourceType b;
+        b.set_value(set_b);
+
+        // into another resource (with a previous value), then into one of the operands
+        ResourceType result;
+        result.set_value(set_b);
+        result.assign_union(a.get_value(), b.get_value());
+        ResourceType aliased_a = a;
+        aliased_a.assign_union(aliased_a.get_value(), b.get_value());
+        ResourceType aliased_b = b;
+        aliased_b.assign_union(a.get_value(), aliased_b.get_value());
+        if (to_set(result) != set_union || to_set(aliased_a) != set_union ||
+            to_set(aliased_b) != set_union) {
+            LOG_ERROR(resource_name, ": in-place union differs (iteration ", iter, ")\n");
+            return false;
+        }
+
+        result.assign_intersection(a.get_value(), b.get_value());
+        aliased_a = a;
+        aliased_a.assign_intersection(aliased_a.get_value(), b.get_value());
+        aliased_b = b;
+        aliased_b.assign_intersection(a.get_value(), aliased_b.get_value());
+        if (to_set(result) != set_intersection || to_set(aliased_a) != set_intersection ||
+            to_set(aliased_b) != set_intersection) {
+            LOG_ERROR(resource_name, ": in-place intersection differs (iteration ", iter, ")\n");
+            return false;
+        }
+
+        // ng-path extension along the arc (origin, destination): keep the values of a in the
+        // neighborhood b of the origin, then add the origin
+        const size_t origin = iter % max_value;
+        const std::map<size_t, std::set<size_t>> ng_neighborhood_by_origin_id{{origin, set_b}};
+        ResourceType origin_resource;
+        origin_resource.add(origin);
+        Extender<ResourceType> ng_extender_prototype(
+            origin_resource,
+            std::make_unique<NgPathExtensionFunction<ResourceType, size_t>>(
+                ng_neighborhood_by_origin_id),
+            0);
+        Node<ResourceType> origin_node(origin, false, false);
+        Node<ResourceType> destination_node(max_value, false, false);
+        Arc<ResourceType> arc(0, &origin_node, &destination_node);
+        auto ng_extender = ng_extender_prototype.clone(arc);
+        Resource<ResourceType> resource_a(nullptr, nullptr, nullptr, a);
+        Resource<ResourceType> extended_resource(nullptr, nullptr, nullptr, b);
+        ng_extender->extend(resource_a, &extended_resource);
+        auto expected = set_intersection;
+        expected.insert(origin);
+        if (to_set(extended_resource) != expected) {
+            LOG_ERROR(resource_name, ": ng-path extension differs (iteration ", iter, ")\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline bool test_dominance_signature() {
+    // Test that the signatures never reject a dominance accepted by the dominance functions
+
+    std::mt19937 rnd(0);
+    std::uniform_real_distribution<double> value_dist(0, 10);
+    std::bernoulli_distribution in_set(0.1);
+    for (size_t iter = 0; iter < 200; ++iter) {
+        // numerical keys (equal values half of the time)
+        Resource<RealResource> lhs_value(
+            std::make_unique<ValueDominanceFunction<RealResource>>(), nullptr, nullptr);
+        Resource<RealResource> rhs_value(
+            std::make_unique<ValueDominanceFunction<RealResource>>(), nullptr, nullptr);
+        lhs_value.set_value(value_dist(rnd));
+        rhs_value.set_value(iter % 2 == 0 ? lhs_value.get_value() : value_dist(rnd));
+        if ((lhs_value <= rhs_value) && !lhs_value.get_dominance_signature().may_dominate(
+                                            rhs_value.get_dominance_signature())) {
+            LOG_ERROR("Signature rejects a value dominance (iteration ", iter, ")\n");
+            return false;
+        }
+
+        // fingerprints (lhs is a subset of rhs half of the time)
+        std::set<size_t> lhs_set;
+        std::set<size_t> rhs_set;
+        for (size_t i = 0; i < 300; ++i) {
+            if (in_set(rnd)) {
+                rhs_set.insert(i);
+                if (iter % 2 == 0 && in_set(rnd)) {
+                    lhs_set.insert(i);
+                }
+            }
+            if (iter % 2 == 1 && in_set(rnd)) {
+                lhs_set.insert(i);
+            }
+        }
+        Resource<SizeTSetResource> lhs_resource(
+            std::make_unique<InclusionDominanceFunction<SizeTSetResource>>(), nullptr, nullptr);
+        Resource<SizeTSetResource> rhs_resource(
+            std::make_unique<InclusionDominanceFunction<SizeTSetResource>>(), nullptr, nullptr);
+        lhs_resource.set_value(lhs_set);
+        rhs_resource.set_value(rhs_set);
+        const bool dominates = lhs_resource <= rhs_resource;
+        if (dominates && !lhs_resource.get_dominance_signature().may_dominate(
+                             rhs_resource.get_dominance_signature())) {
+            LOG_ERROR("Signature rejects a set inclusion (iteration ", iter, ")\n");
+            return false;
+        }
+        const BitsetResource<size_t> lhs_bitset(lhs_set);
+        const BitsetResource<size_t> rhs_bitset(rhs_set);
+        const FixedBitsetResource<300> lhs_fixed_bitset(lhs_set);
+        const FixedBitsetResource<300> rhs_fixed_bitset(rhs_set);
+        if (dominates && ((lhs_bitset.get_fingerprint() & ~rhs_bitset.get_fingerprint()) != 0 ||
+                          (lhs_fixed_bitset.get_fingerprint() &
+                           ~rhs_fixed_bitset.get_fingerprint()) != 0)) {
+            LOG_ERROR("Bitset fingerprints reject a set inclusion (iteration ", iter, ")\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline bool test_dominance_index() {
+    // Test the dominance queries of the k-d tree against a linear scan
+
+    constexpr size_t num_dimensions = 3;
+    using Index = DominanceIndex<size_t>;
+    using Point = Index::Point;
+
+    std::mt19937 rnd(0);
+    // few distinct values, to have equal coordinates
+    std::uniform_int_distribution<int> coordinate_dist(0, 20);
+    const auto random_point = [&]() {
+        Point point{};
+        for (size_t d = 0; d < num_dimensions; ++d) {
+            point[d] = coordinate_dist(rnd);
+        }
+        return point;
+    };
+    const auto leq = [](const Point& lhs, const Point& rhs) {
+        for (size_t d = 0; d < num_dimensions; ++d) {
+            if (!value_leq(lhs[d], rhs[d])) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<Point> points;
+    std::vector<bool> erased;
+    std::vector<std::pair<Point, size_t>> initial_points;
+    for (size_t i = 0; i < 100; ++i) {
+        points.push_back(random_point());
+        erased.push_back(false);
+        initial_points.emplace_back(points.back(), i);
+    }
+    Index index;
+    index.build(initial_points, num_dimensions);
+
+    for (size_t iter = 0; iter < 500; ++iter) {
+        const auto query = random_point();
+
+        bool expected_leq = false;
+        for (size_t i = 0; i < points.size(); ++i) {
+            expected_leq = expected_leq || (!erased[i] && leq(points[i], query));
+        }
+        if (index.any_leq(query, [](size_t /*value*/) { return true; }) != expected_leq) {
+            LOG_ERROR(
+                "DominanceIndex::any_leq differs from a linear scan (iteration ", iter, ")\n");
+            return false;
+        }
+
+        if (iter % 2 == 0) {
+            // erase the greater or equal points with an even value
+            std::vector<size_t> visited;
+            index.erase_geq_if(query, [&visited](size_t value) {
+                visited.push_back(value);
+                return value % 2 == 0;
+            });
+            std::vector<size_t> expected_visited;
+            for (size_t i = 0; i < points.size(); ++i) {
+                if (!erased[i] && leq(query, points[i])) {
+                    expected_visited.push_back(i);
+                    erased[i] = i % 2 == 0;
+                }
+            }
+            std::ranges::sort(visited);
+            if (visited != expected_visited) {
+                LOG_ERROR("DominanceIndex::erase_geq_if differs from a linear scan (iteration ",
+                          iter,
+                          ")\n");
+                return false;
+            }
+        } else {
+            // insert a point, and erase a random one
+            points.push_back(random_point());
+            erased.push_back(false);
+            index.insert(points.back(), points.size() - 1);
+            const size_t i = rnd() % points.size();
+            if (index.erase(points[i], i) == erased[i]) {
+                LOG_ERROR("DominanceIndex::erase failed (iteration ", iter, ")\n");
+                return false;
+            }
+            erased[i] = true;
+        }
+
+        if (index.needs_rebuild()) {
+            std::vector<std::pair<Point, size_t>> live_points;
+            for (size_t i = 0; i < points.size(); ++i) {
+                if (!erased[i]) {
+                    live_points.emplace_back(points[i], i);
+                }
+            }
+            index.build(live_points, num_dimensions);
+        }
+    }
+
+    return true;
+}
+
+inline bool test_dominance_kernels() {
+    // Test the batched dominance masks (scalar, AVX2 and AVX-512 kernels) against a naive check
+
+    constexpr size_t num_dimensions = 3;
+    constexpr size_t num_points = 150;
+
+    std::mt19937 rnd(0);
+    // few distinct values, to have equal coordinates
+    std::uniform_int_distribution<int> coordinate_dist(0, 5);
+    std::array<std::vector<double>, num_dimensions> columns;
+    for (size_t i = 0; i < num_points; ++i) {
+        for (size_t d = 0; d < num_dimensions; ++d) {
+            columns[d].push_back(coordinate_dist(rnd));
+        }
+        if (i % 7 == 0) {
+            // an erased point
+            columns[0].back() = std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+    std::array<const double*, num_dimensions> column_ptrs{};
+    for (size_t d = 0; d < num_dimensions; ++d) {
+        column_ptrs[d] = columns[d].data();
+    }
+
+    using MaskFunction = uint64_t (*)(const double* const*, size_t, size_t, size_t, const double*);
+    std::vector<std::pair<std::string, std::pair<MaskFunction, MaskFunction>>> kernels = {
+        {"scalar", {dominance_kernels::leq_mask_scalar, dominance_kernels::geq_mask_scalar}},
+        {"dispatch", {dominance_kernels::leq_mask, dominance_kernels::geq_mask}}};
+#ifdef RCSPP_BITSET_SIMD
+    if (__builtin_cpu_supports("avx2") != 0) {
+        kernels.push_back(
+            {"avx2", {dominance_kernels::leq_mask_avx2, dominance_kernels::geq_mask_avx2}});
+    }
+    if (__builtin_cpu_supports("avx512f") != 0) {
+        kernels.push_back(
+            {"avx512", {dominance_kernels::leq_mask_avx512, dominance_kernels::geq_mask_avx512}});
+    }
+#endif
+
+    for (size_t iter = 0; iter < 200; ++iter) {
+        std::array<double, num_dimensions> point{};
+        for (size_t d = 0; d < num_dimensions; ++d) {
+            point[d] = coordinate_dist(rnd);
+        }
+        // batches of any size (including the tails of the SIMD kernels)
+        const size_t first = rnd() % num_points;
+        const size_t n =
+            std::min<size_t>(rnd() % (dominance_kernels::MAX_BATCH_SIZE + 1), num_points - first);
+
+        uint64_t expected_leq_mask = 0;
+        uint64_t expected_geq_mask = 0;
+        for (size_t j = 0; j < n; ++j) {
+            bool leq = true;
+            bool geq = true;
+            for (size_t d = 0; d < num_dimensions; ++d) {
+                leq = leq && columns[d][first + j] <= point[d];
+                geq = geq && point[d] <= columns[d][first + j];
+            }
+            expected_leq_mask |= static_cast<uint64_t>(leq) << j;
+            expected_geq_mask |= static_cast<uint64_t>(geq) << j;
+        }
+
+        for (const auto& [name, functions] : kernels) {
+            const auto& [leq_mask, geq_mask] = functions;
+            if (leq_mask(column_ptrs.data(), num_dimensions, first, n, point.data()) !=
+                    expected_leq_mask ||
+                geq_mask(column_ptrs.data(), num_dimensions, first, n, point.data()) !=
+                    expected_geq_mask) {
+                LOG_ERROR("Dominance kernel ",
+                          name,
+                          " differs from a naive check (iteration ",
+                          iter,
+                          ")\n");
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <limits>
 #include <ranges>
+#include <thread>  // NOLINT
 
 #include "vrp_subproblem.hpp"
 #include "rcspp/rcspp.hpp"
@@ -16,6 +17,8 @@ VRPSubproblem::VRPSubproblem(Instance instance,
       time_window_by_customer_id_(initialize_time_windows()) {
     LOG_TRACE("VRPSubproblem::VRPSubproblem\n");
     construct_resource_graph(&graph_);
+    construct_backward_resource_graph(&backward_graph_);
+    construct_resource_graph(&static_graph_);
 }
 
 std::map<size_t, std::pair<int, int>> VRPSubproblem::initialize_time_windows() {
@@ -90,38 +93,183 @@ RGraph* resource_graph,
     add_all_arcs_to_graph(resource_graph, dual_by_id);
 }
 
+void VRPSubproblem::construct_backward_resource_graph(RGraph* resource_graph) {
+    LOG_TRACE(__FUNCTION__, '\n');
+
+    // A time window [a, b] becomes [H - b, H - a], where H is the latest time a path can return
+    // to the depot (the sink window of the forward graph has no due time): the backward search
+    // starts from the sink at H, which any forward path can wait for.
+    const auto& depot = instance_.get_depot_customer();
+    backward_horizon_ = depot.due_time;
+    for (const auto& [customer_id, customer] : instance_.get_customers_by_id()) {
+        backward_horizon_ = std::max(
+            backward_horizon_,
+            customer.due_time + customer.service_time + calculate_distance(customer, depot));
+    }
+    for (const auto& [node_id, max_time] : max_time_window_by_node_id_) {
+        backward_min_time_window_by_node_id_.emplace(node_id, backward_horizon_ - max_time);
+    }
+    for (const auto& [node_id, min_time] : min_time_window_by_node_id_) {
+        backward_max_time_window_by_node_id_.emplace(node_id, backward_horizon_ - min_time);
+    }
+
+    // Distance (cost)
+    resource_graph->add_resource<RealResource>(
+        std::make_unique<AdditionExtensionFunction<RealResource>>(),
+        std::make_unique<TrivialFeasibilityFunction<RealResource>>(),
+        std::make_unique<ValueCostFunction<RealResource>>(),
+        std::make_unique<ValueDominanceFunction<RealResource>>());
+
+    // Time
+    resource_graph->add_resource<RealResource>(
+        std::make_unique<TimeWindowExtensionFunction<RealResource>>(
+            backward_min_time_window_by_node_id_),
+        std::make_unique<TimeWindowFeasibilityFunction<RealResource>>(
+            backward_max_time_window_by_node_id_),
+        std::make_unique<ValueCostFunction<RealResource>>(),
+        std::make_unique<ValueDominanceFunction<RealResource>>());
+
+    // Demand
+    resource_graph->add_resource<IntResource>(
+        std::make_unique<AdditionExtensionFunction<IntResource>>(),
+        std::make_unique<MinMaxFeasibilityFunction<IntResource>>(0, instance_.get_capacity()),
+        std::make_unique<ValueCostFunction<IntResource>>(),
+        std::make_unique<ValueDominanceFunction<IntResource>>());
+
+    add_all_nodes_to_graph(resource_graph, true);
+
+    add_all_arcs_to_graph(resource_graph, nullptr, true);
+}
+
+std::vector<Solution> VRPSubproblem::solve_bidirectional(
+    const std::map<size_t, double>& dual_by_id) {
+    LOG_TRACE(__FUNCTION__, '\n');
+
+    update_resource_graph(&graph_, &dual_by_id);
+    update_resource_graph(&backward_graph_, &dual_by_id);
+
+    // Both searches stop at half of the horizon of the backward graph on the time resource. A
+    // forward and a backward label can only be joined if the forward time does not exceed the
+    // latest start time of the backward label (the horizon minus its backward time) and their
+    // loads fit in the vehicle.
+    const double horizon = backward_horizon_;
+    const double midpoint = horizon / 2.0;
+    const int capacity = instance_.get_capacity();
+    auto algorithm = graph_.create_algorithm<BidirectionalDominanceAlgorithm>(
+        AlgorithmParams{},
+        &backward_graph_,
+        [](const Resource<ResourceComposition<RealResource, IntResource>>& resource) {
+            return resource.get_resource_component<0>(1).get_value();
+        },
+        midpoint,
+        midpoint,
+        [horizon, capacity](
+            const Resource<ResourceComposition<RealResource, IntResource>>& forward_resource,
+            const Resource<ResourceComposition<RealResource, IntResource>>& backward_resource) {
+            return forward_resource.get_resource_component<0>(1).get_value() +
+                           backward_resource.get_resource_component<0>(1).get_value() <=
+                       horizon + 1e-6 &&  // NOLINT
+                   forward_resource.get_resource_component<1>(0).get_value() +
+                           backward_resource.get_resource_component<1>(0).get_value() <=
+                       capacity;
+        });
+
+    return graph_.solve(algorithm.get());
+}
+
+std::vector<Solution> VRPSubproblem::solve_static(const std::map<size_t, double>& dual_by_id) {
+    LOG_TRACE(__FUNCTION__, '\n');
+
+    update_resource_graph(&static_graph_, &dual_by_id);
+
+    return static_graph_.solve();
+}
+
+std::vector<std::vector<Solution>> VRPSubproblem::solve_concurrently(
+    const std::map<size_t, double>& dual_by_id, const std::vector<double>& upper_bounds,
+    const SolutionCallback& callback) {
+    LOG_TRACE(__FUNCTION__, '\n');
+
+    update_resource_graph(&graph_, &dual_by_id);
+
+    std::vector<std::vector<Solution>> solutions_by_solve(upper_bounds.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < upper_bounds.size(); ++i) {
+        threads.emplace_back([this, &upper_bounds, &solutions_by_solve, &callback, i]() {
+            auto algorithm = graph_.create_algorithm<SimpleDominanceAlgorithm>(AlgorithmParams{});
+            algorithm->set_solution_callback(callback);
+            solutions_by_solve[i] = graph_.solve(algorithm.get(), upper_bounds[i]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return solutions_by_solve;
+}
+
+std::vector<std::vector<Solution>> VRPSubproblem::solve_batch(
+    const std::vector<std::map<size_t, double>>& dual_by_id_batch) {
+    LOG_TRACE(__FUNCTION__, '\n');
+
+    std::vector<std::vector<double>> duals_batch;
+    duals_batch.reserve(dual_by_id_batch.size());
+    for (const auto& dual_by_id : dual_by_id_batch) {
+        duals_batch.push_back(get_duals(dual_by_id));
+    }
+
+    return graph_.solve_batch(duals_batch);
+}
+
+std::vector<Solution> VRPSubproblem::solve_with_algorithm(
+    const std::map<size_t, double>& dual_by_id,
+    Algorithm<ResourceComposition<RealResource, IntResource>>* algorithm) {
+    LOG_TRACE(__FUNCTION__, '\n');
+
+    update_resource_graph(&graph_, &dual_by_id);
+
+    return graph_.solve(algorithm);
+}
+
 void VRPSubproblem::update_resource_graph(RGraph* resource_graph,
                                 const std::map<size_t, double>* dual_by_id) {
     LOG_TRACE(__FUNCTION__, '\n');
 
-    const auto max_arc_id = dual_by_id->rbegin()->first;
+    resource_graph->update_reduced_costs(get_duals(*dual_by_id));
+}
+
+std::vector<double> VRPSubproblem::get_duals(const std::map<size_t, double>& dual_by_id) {
+    const auto max_arc_id = dual_by_id.rbegin()->first;
     std::vector<double> duals(max_arc_id + 1, 0.0);
-    for (const auto& [arc_id, dual_value] : *dual_by_id) {
+    for (const auto& [arc_id, dual_value] : dual_by_id) {
         duals.at(arc_id) = dual_value;
     }
 
-    graph_.update_reduced_costs(duals);
+    return duals;
 }
 
-void VRPSubproblem::add_all_nodes_to_graph(RGraph* resource_graph) {
+void VRPSubproblem::add_all_nodes_to_graph(RGraph* resource_graph, bool backward) {
     LOG_TRACE(__FUNCTION__, '\n');
 
     const auto& customers_by_id = instance_.get_customers_by_id();
     size_t sink_id = customers_by_id.size();
 
     for (const auto& [customer_id, customer] : customers_by_id) {
-        auto& node = resource_graph->add_node(customer_id, customer.depot);
+        // In the backward graph, the sources and the sinks are swapped.
+        auto& node = resource_graph->add_node(customer_id,
+                                              customer.depot && !backward,
+                                              customer.depot && backward);
         if (customer.depot) {
             depot_id_ = customer.id;
 
             // Add the depot as a sink as well.
-            auto& sink_node = resource_graph->add_node(sink_id, false, true);
+            auto& sink_node = resource_graph->add_node(sink_id, backward, !backward);
         }
     }
 }
 
 void VRPSubproblem::add_all_arcs_to_graph(RGraph* resource_graph,
-                                const std::map<size_t, double>* dual_by_id) {
+                                const std::map<size_t, double>* dual_by_id, bool backward) {
     const auto& customers_by_id = instance_.get_customers_by_id();
     size_t sink_id = customers_by_id.size();
 
@@ -135,7 +283,8 @@ void VRPSubproblem::add_all_arcs_to_graph(RGraph* resource_graph,
                                  customer_orig,
                                  customer_dest,
                                  dual_by_id,
-                                 arc_id);
+                                 arc_id,
+                                 backward);
                 arc_id++;
             }
         }
@@ -147,7 +296,8 @@ void VRPSubproblem::add_all_arcs_to_graph(RGraph* resource_graph,
                          customer_orig,
                          sink_customer,
                          dual_by_id,
-                         arc_id);
+                         arc_id,
+                         backward);
         arc_id++;
     }
 }
@@ -155,7 +305,8 @@ void VRPSubproblem::add_all_arcs_to_graph(RGraph* resource_graph,
 void VRPSubproblem::add_arc_to_graph(RGraph* resource_graph, size_t customer_orig_id,
                            size_t customer_dest_id, const Customer& customer_orig,
                            const Customer& customer_dest,
-                           const std::map<size_t, double>* dual_by_id, size_t arc_id) {
+                           const std::map<size_t, double>* dual_by_id, size_t arc_id,
+                           bool backward) {
     double distance = calculate_distance(customer_orig, customer_dest);
     double customer_pi = 0;
     if (!customer_orig.depot && dual_by_id != nullptr) {
@@ -183,10 +334,11 @@ void VRPSubproblem::add_arc_to_graph(RGraph* resource_graph, size_t customer_ori
         distance,
         {Row(customer_orig_id, row_coefficient)});*/
 
+    // The backward arc goes from the destination to the origin, with the same consumption.
     resource_graph->add_arc<RealResource, RealResource, IntResource>(
         {reduced_cost, time, demand},
-        customer_orig_id,
-        customer_dest_id,
+        backward ? customer_dest_id : customer_orig_id,
+        backward ? customer_orig_id : customer_dest_id,
         arc_id,
         distance,
         {Row(customer_orig_id, row_coefficient)});
@@ -208,3 +360,18 @@ double VRPSubproblem::calculate_solution_cost(const Solution& solution) const {
 
     return cost;
 }
+
+double VRPSubproblem::calculate_reduced_cost(const Solution& solution,
+                                             const std::map<size_t, double>& dual_by_id) const {
+    auto duals = get_duals(dual_by_id);
+    double reduced_cost = 0.0;
+    for (auto arc_id : solution.path_arc_ids) {
+        const auto* arc_ptr = graph_.get_arc(arc_id);
+        reduced_cost += arc_ptr->cost;
+        for (const auto& dual_row : arc_ptr->dual_rows) {
+            reduced_cost -= dual_row.coefficient * duals.at(dual_row.index);
+        }
+    }
+
+    return reduced_cost;
+}
@@ -3,6 +3,7 @@
 #include "rcspp/rcspp.hpp"
 #include "vrp/instance.hpp"
 
+#include <memory>
 #include <optional>
 
 
@@ -10,6 +11,18 @@ using namespace rcspp;
 
 using RGraph = ResourceGraph<RealResource, IntResource>;
 
+// Functions of the resources added by construct_resource_graph (distance, time and demand).
+using VRPStaticComponents = StaticComponents<
+    StaticComponent<RealResource, AdditionExtensionFunction<RealResource>,
+                    TrivialFeasibilityFunction<RealResource>, ValueCostFunction<RealResource>,
+                    ValueDominanceFunction<RealResource>>,
+    StaticComponent<RealResource, TimeWindowExtensionFunction<RealResource>,
+                    TimeWindowFeasibilityFunction<RealResource>, ValueCostFunction<RealResource>,
+                    ValueDominanceFunction<RealResource>>,
+    StaticComponent<IntResource, AdditionExtensionFunction<IntResource>,
+                    MinMaxFeasibilityFunction<IntResource>, ValueCostFunction<IntResource>,
+                    ValueDominanceFunction<IntResource>>>;
+
 class VRPSubproblem {
     // Solve one iteration of the subproblem of the VRPTW
 
@@ -35,6 +48,42 @@ class VRPSubproblem {
         return solutions_rcspp;
     }
 
+    // Same as solve, with the bidirectional algorithm on the graph and the backward graph.
+    std::vector<Solution> solve_bidirectional(const std::map<size_t, double>& dual_by_id);
+
+    // Same as solve, on a graph with the static composition functions.
+    std::vector<Solution> solve_static(const std::map<size_t, double>& dual_by_id);
+
+    // Same as solve, with one concurrent solve on the same graph by upper bound. Each solve
+    // streams its solutions to its own copy of the callback (if any).
+    std::vector<std::vector<Solution>> solve_concurrently(
+        const std::map<size_t, double>& dual_by_id, const std::vector<double>& upper_bounds,
+        const SolutionCallback& callback = {});
+
+    // Same as solve, for each duals of the batch, in parallel on the same graph.
+    std::vector<std::vector<Solution>> solve_batch(
+        const std::vector<std::map<size_t, double>>& dual_by_id_batch);
+
+    // Algorithm (simple dominance by default) with the given parameters, and the other arguments
+    // of its constructor, on the graph of the subproblem (e.g., to reuse it from one call of
+    // solve_with_algorithm to the next).
+    template <template <typename> class AlgorithmType = SimpleDominanceAlgorithm, typename... Args>
+    std::unique_ptr<Algorithm<ResourceComposition<RealResource, IntResource>>> create_algorithm(
+        const AlgorithmParams& params, Args&&... args) {
+        LOG_TRACE(__FUNCTION__, '\n');
+
+        return graph_.create_algorithm<AlgorithmType>(params, std::forward<Args>(args)...);
+    }
+
+    // Same as solve, with the given algorithm (see create_algorithm).
+    std::vector<Solution> solve_with_algorithm(
+        const std::map<size_t, double>& dual_by_id,
+        Algorithm<ResourceComposition<RealResource, IntResource>>* algorithm);
+
+    // Reduced cost of the path of the solution with the given duals.
+    [[nodiscard]] double calculate_reduced_cost(const Solution& solution,
+                                                const std::map<size_t, double>& dual_by_id) const;
+
     private:
 
         const std::map<size_t, double>* row_coefficient_by_id_;
@@ -44,12 +93,24 @@ class VRPSubproblem {
         std::map<size_t, double> min_time_window_by_node_id_;
         std::map<size_t, double> max_time_window_by_node_id_;
 
+        // Time windows of the backward graph (referenced by its time window functions).
+        std::map<size_t, double> backward_min_time_window_by_node_id_;
+        std::map<size_t, double> backward_max_time_window_by_node_id_;
+
         size_t path_id_;
 
         std::map<size_t, std::pair<int, int>> time_window_by_customer_id_;
 
         RGraph graph_;
 
+        // Reversed graph (same arc ids) with time windows mirrored over the latest return time to
+        // the depot (see construct_backward_resource_graph).
+        RGraph backward_graph_;
+        double backward_horizon_ = 0.0;
+
+        // Same graph as graph_, without virtual calls to the functions of the resources.
+        RGraph static_graph_{VRPStaticComponents{}};
+
         size_t depot_id_;
 
         Timer total_subproblem_time_;
@@ -60,18 +121,25 @@ class VRPSubproblem {
         RGraph* resource_graph,
             const std::map<size_t, double>* dual_by_id = nullptr);
 
+        void construct_backward_resource_graph(RGraph* resource_graph);
+
         void update_resource_graph(RGraph* resource_graph,
                                    const std::map<size_t, double>* dual_by_id);
 
-        void add_all_nodes_to_graph(RGraph* graph);
+        [[nodiscard]] static std::vector<double> get_duals(
+            const std::map<size_t, double>& dual_by_id);
+
+        void add_all_nodes_to_graph(RGraph* graph, bool backward = false);
 
         void add_all_arcs_to_graph(RGraph* graph,
-                                   const std::map<size_t, double>* dual_by_id);
+                                   const std::map<size_t, double>* dual_by_id,
+                                   bool backward = false);
 
         void add_arc_to_graph(RGraph* graph, size_t customer_orig_id,
                                      size_t customer_dest_id, const Customer& customer_orig,
                                      const Customer& customer_dest,
-                                     const std::map<size_t, double>* dual_by_id, size_t arc_id);
+                                     const std::map<size_t, double>* dual_by_id, size_t arc_id,
+                                     bool backward = false);
 
         [[nodiscard]] static double calculate_distance(const Customer& customer1,
                                                        const Customer& customer2);